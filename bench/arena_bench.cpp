@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+/*
+ * Benchmark: per message decode into a temporary host order buffer with std::allocator, Pool and Arena.
+ * Every message allocates a buffer, converts a big endian payload into it, reads it and frees it again.
+ *
+ * usage: bench_arena [messages per thread] [threads]
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/arena.hpp"
+#include "cxxendian/bulk.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace cxxendian;
+
+namespace {
+
+constexpr std::size_t MAX_ELEMENTS = 4096;
+
+// payload sizes of the simulated messages (mostly small, some large)
+std::vector<std::size_t> make_sizes(std::size_t n) {
+    std::mt19937_64                            rng(42);
+    std::uniform_int_distribution<std::size_t> small(4, 256);
+    std::uniform_int_distribution<std::size_t> large(257, MAX_ELEMENTS);
+    std::vector<std::size_t>                   sizes(n);
+    for (auto &s : sizes)
+        s = rng() % 8 ? small(rng) : large(rng);
+    return sizes;
+}
+
+std::uint64_t consume(const std::uint32_t *v, std::size_t n) {
+    return v[0] + v[n / 2] + v[n - 1];
+}
+
+struct Std_Allocator {
+    static std::uint64_t decode(const std::uint8_t *wire, std::size_t n) {
+        std::allocator<std::uint32_t> alloc;
+        std::uint32_t                *buf = alloc.allocate(n);
+        endian::big_to_host_n(wire, buf, n);
+        const auto r = consume(buf, n);
+        alloc.deallocate(buf, n);
+        return r;
+    }
+};
+
+struct Pool_Alloc {
+    static std::uint64_t decode(const std::uint8_t *wire, std::size_t n) {
+        Pool          &pool = thread_pool();
+        std::uint32_t *buf  = pool.allocate<std::uint32_t>(n);
+        endian::big_to_host_n(wire, buf, n);
+        const auto r = consume(buf, n);
+        pool.deallocate(buf, n);
+        return r;
+    }
+};
+
+struct Arena_Alloc {
+    static std::uint64_t decode(const std::uint8_t *wire, std::size_t n) {
+        Arena_Scope scope;
+        const auto *buf = to_host_scratch<endian::Order::Big, std::uint32_t>(wire, n);
+        return consume(buf, n);
+    }
+};
+
+template <typename Impl>
+double run(const std::vector<std::size_t> &sizes, const std::uint8_t *wire, unsigned threads) {
+    std::vector<std::thread>   workers;
+    std::vector<std::uint64_t> sums(threads);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            std::uint64_t sum = 0;
+            for (const auto n : sizes)
+                sum += Impl::decode(wire, n);
+            sums[t] = sum;
+        });
+    }
+    for (auto &w : workers)
+        w.join();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    if (std::adjacent_find(sums.begin(), sums.end(), std::not_equal_to<>()) != sums.end()) std::abort();
+    return static_cast<double>(sizes.size()) * threads / elapsed.count();
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::size_t messages = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    const unsigned    max_threads =
+            argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : std::max(1u, std::thread::hardware_concurrency());
+
+    const auto                sizes = make_sizes(messages);
+    std::vector<std::uint8_t> wire(MAX_ELEMENTS * 4);
+    for (std::size_t i = 0; i < wire.size(); ++i)
+        wire[i] = static_cast<std::uint8_t>(i * 7);
+
+    std::printf("%-16s %8s %16s\n", "allocator", "threads", "messages/s");
+    for (unsigned threads : {1u, max_threads}) {
+        std::printf("%-16s %8u %16.0f\n", "std::allocator", threads, run<Std_Allocator>(sizes, wire.data(), threads));
+        std::printf("%-16s %8u %16.0f\n", "Pool", threads, run<Pool_Alloc>(sizes, wire.data(), threads));
+        std::printf("%-16s %8u %16.0f\n", "Arena", threads, run<Arena_Alloc>(sizes, wire.data(), threads));
+        if (max_threads == 1) break;
+    }
+}
@@ -0,0 +1,55 @@
+#
+# Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+# This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+#
+
+# Compile time benchmark: compiles SOURCE RUNS times per configuration and prints the mean time.
+#
+# usage: cmake -DCXX=<compiler> -DSTANDARD=<17|20> -DINCLUDE=<include dir> -DSOURCE=<file> -DOUTPUT=<object file>
+#              [-DRUNS=<n>] -P compile_time.cmake
+
+if(NOT CXX OR NOT INCLUDE OR NOT SOURCE OR NOT OUTPUT)
+    message(FATAL_ERROR "CXX, INCLUDE, SOURCE and OUTPUT must be set")
+endif()
+if(NOT STANDARD)
+    set(STANDARD 17)
+endif()
+if(NOT RUNS)
+    set(RUNS 5)
+endif()
+
+set(CONFIGURATIONS "baseline umbrella" "header only" "extern templates" "fwd.hpp only")
+set(DEFINES_baseline_umbrella "-DBENCH_BASELINE_UMBRELLA")
+set(DEFINES_header_only "")
+set(DEFINES_extern_templates "-DCXXENDIAN_EXTERN_TEMPLATES")
+set(DEFINES_fwd.hpp_only "-DBENCH_FWD_ONLY")
+
+# time of one compiler run in microseconds
+function(compile_once DEFINES RESULT)
+    string(TIMESTAMP START "%s%f")
+    execute_process(
+            COMMAND ${CXX} -std=c++${STANDARD} -O2 -I${INCLUDE} ${DEFINES} -c ${SOURCE} -o ${OUTPUT}
+            RESULT_VARIABLE STATUS
+            ERROR_VARIABLE ERRORS)
+    string(TIMESTAMP STOP "%s%f")
+    if(NOT STATUS EQUAL 0)
+        message(FATAL_ERROR "compilation failed:\n${ERRORS}")
+    endif()
+    math(EXPR ELAPSED "${STOP} - ${START}")
+    set(${RESULT} ${ELAPSED} PARENT_SCOPE)
+endfunction()
+
+foreach(CONFIGURATION IN LISTS CONFIGURATIONS)
+    string(REPLACE " " "_" KEY "${CONFIGURATION}")
+
+    compile_once("${DEFINES_${KEY}}" WARMUP)
+    set(TOTAL 0)
+    foreach(RUN RANGE 1 ${RUNS})
+        compile_once("${DEFINES_${KEY}}" ELAPSED)
+        math(EXPR TOTAL "${TOTAL} + ${ELAPSED}")
+    endforeach()
+
+    math(EXPR MEAN_MS "${TOTAL} / ${RUNS} / 1000")
+    file(SIZE ${OUTPUT} OBJECT_SIZE)
+    message(STATUS "${CONFIGURATION}: ${MEAN_MS} ms (mean of ${RUNS} runs), object file: ${OBJECT_SIZE} bytes")
+endforeach()
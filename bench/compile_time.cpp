@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+/*
+ * Translation unit for the compile time benchmark (see compile_time.cmake).
+ * Uses the endian types the way a typical protocol handling source file does. With BENCH_FWD_ONLY it only contains
+ * the declarations that a header of such a project would see. With BENCH_BASELINE_UMBRELLA the core headers that
+ * cxxendian.hpp originally consisted of are included instead of cxxendian.hpp (reference for the cost of the umbrella
+ * header).
+ */
+
+#include <cstdint>
+
+#if defined(BENCH_FWD_ONLY)
+#    include "cxxendian/fwd.hpp"
+
+using namespace cxxendian;
+
+std::uint32_t decode_u32(const BE_Int<std::uint32_t> &v) noexcept;
+std::int16_t  decode_i16(const LE_Int<std::int16_t> &v) noexcept;
+double        decode_f64(const BE_Float<double> &v) noexcept;
+float         decode_f32(const LE_Float<float> &v) noexcept;
+
+struct Message {
+    const BE_Int<std::uint16_t> *id;
+    const LE_Int<std::uint64_t> *timestamp;
+    const BE_Float<double>      *value;
+};
+#else
+#    if defined(BENCH_BASELINE_UMBRELLA)
+#        include "cxxendian/base_float.hpp"
+#        include "cxxendian/base_int.hpp"
+#        include "cxxendian/float.hpp"
+#        include "cxxendian/float_operators.hpp"
+#        include "cxxendian/int.hpp"
+#        include "cxxendian/int_operators.hpp"
+#    else
+#        include "cxxendian.hpp"
+#    endif
+
+using namespace cxxendian;
+
+template <typename T>
+T sum_int(T a, T b, T c) {
+    LE_Int<T>   x(a);
+    BE_Int<T>   y(b);
+    Host_Int<T> z(c);
+    BE_Int<T>   r(x + y);
+    r += z;
+    r ^= x;
+    r = r | y;
+    return static_cast<T>(r.get() + ((x < y) ? T(1) : T(0)) + ((y == z) ? T(1) : T(0)));
+}
+
+template <typename T>
+T sum_float(T a, T b, T c) {
+    LE_Float<T>   x(a);
+    BE_Float<T>   y(b);
+    Host_Float<T> z(c);
+    BE_Float<T>   r(x * y);
+    r += z;
+    r = r - x;
+    return r.get() + ((x < y) ? T(1) : T(0));
+}
+
+template <typename T>
+const Base_Int<T> *make_int(bool big, T v) {
+    if (big) return new BE_Int<T>(v);
+    return new LE_Int<T>(v);
+}
+
+std::uint64_t use_all(std::uint64_t v) {
+    std::uint64_t s = 0;
+    s += static_cast<std::uint64_t>(sum_int<std::int8_t>(1, 2, 3));
+    s += sum_int<std::uint8_t>(1, 2, 3);
+    s += static_cast<std::uint64_t>(sum_int<std::int16_t>(1, 2, 3));
+    s += sum_int<std::uint16_t>(1, 2, 3);
+    s += static_cast<std::uint64_t>(sum_int<std::int32_t>(1, 2, 3));
+    s += sum_int<std::uint32_t>(1, 2, 3);
+    s += static_cast<std::uint64_t>(sum_int<std::int64_t>(1, 2, 3));
+    s += sum_int<std::uint64_t>(1, 2, v);
+    s += static_cast<std::uint64_t>(sum_float<float>(1.f, 2.f, 3.f));
+    s += static_cast<std::uint64_t>(sum_float<double>(1., 2., 3.));
+
+    const auto *p = make_int<std::uint32_t>(v & 1, 42);
+    s += p->get();
+    delete p;
+    return s;
+}
+#endif
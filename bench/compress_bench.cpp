@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+/*
+ * Benchmark: compression of big endian integer arrays.
+ * Compares the plain conversion to host order with the fused conversion and bit packing (frame of reference and delta)
+ * and with the unpacking back to big endian. Reports the compression ratio of both modes.
+ *
+ * usage: bench_compress [elements] [repetitions]
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/bulk.hpp"
+#include "cxxendian/compress.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using endian::Order;
+using endian::Pack_Mode;
+
+namespace {
+
+volatile std::size_t sink;
+
+// hide the input from the optimizer, so the conversion is not hoisted out of the repetition loop
+template <typename T>
+T *opaque(T *p) {
+    T *volatile v = p;
+    return v;
+}
+
+template <typename F>
+double run(std::size_t bytes, std::size_t repetitions, F &&f) {
+    std::size_t result = 0;
+    const auto  start  = std::chrono::steady_clock::now();
+    for (std::size_t r = 0; r < repetitions; ++r)
+        result += f();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    sink                                        = result;
+    return static_cast<double>(bytes) * static_cast<double>(repetitions) / elapsed.count() / 1e9;
+}
+
+template <typename T>
+void bench(const char *name, const std::vector<T> &host, std::size_t repetitions) {
+    const std::size_t         n     = host.size();
+    const std::size_t         bytes = n * sizeof(T);
+    std::vector<std::uint8_t> wire(bytes), out(bytes), packed(endian::max_packed_size<T>(n));
+    std::vector<T>            tmp(n);
+    endian::host_to_big_n(host.data(), wire.data(), n);
+
+    const double convert = run(bytes, repetitions, [&] {
+        endian::big_to_host_n(opaque(wire.data()), tmp.data(), n);
+        return static_cast<std::size_t>(tmp[n / 2]);
+    });
+
+    double pack[2], unpack[2], ratio[2];
+    for (const Pack_Mode mode : {Pack_Mode::For, Pack_Mode::Delta}) {
+        const int   m    = mode == Pack_Mode::Delta;
+        std::size_t size = 0;
+        pack[m]          = run(bytes, repetitions, [&] {
+            return size = endian::pack_n<Order::Big, T>(opaque(wire.data()), n, packed.data(), mode);
+        });
+        unpack[m]        = run(bytes, repetitions, [&] {
+            std::size_t consumed = 0;
+            endian::unpack_n<Order::Big, T>(opaque(packed.data()), size, out.data(), n, mode, consumed);
+            return consumed;
+        });
+        ratio[m]         = static_cast<double>(bytes) / static_cast<double>(size);
+    }
+
+    std::printf("%-12s %9.2f %9.2f %9.2f %9.2f %9.2f %7.2f %7.2f\n",
+                name,
+                convert,
+                pack[0],
+                unpack[0],
+                pack[1],
+                unpack[1],
+                ratio[0],
+                ratio[1]);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::size_t n           = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 16;
+    const std::size_t repetitions = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000;
+
+    std::mt19937_64 rng(1);
+
+    // nanosecond timestamps with 1 ms period and jitter
+    std::vector<std::uint64_t> timestamps(n);
+    std::uint64_t              t = 1666000000000000000ull;
+    for (auto &v : timestamps)
+        v = t += 1000000 + rng() % 1000;
+
+    // sensor values around an offset
+    std::vector<std::int32_t> samples(n);
+    for (auto &v : samples)
+        v = static_cast<std::int32_t>(-20000 + static_cast<std::int64_t>(rng() % 4096));
+
+    // counters
+    std::vector<std::uint16_t> counters(n);
+    for (std::size_t i = 0; i < n; ++i)
+        counters[i] = static_cast<std::uint16_t>(i);
+
+    std::printf("GB/s of big endian input, %zu elements; ratio: input size / packed size\n", n);
+    std::printf("%-12s %9s %9s %9s %9s %9s %7s %7s\n",
+                "data",
+                "convert",
+                "pack for",
+                "unp. for",
+                "pack dlt",
+                "unp. dlt",
+                "for",
+                "delta");
+    bench("timestamps", timestamps, repetitions);
+    bench("samples", samples, repetitions);
+    bench("counters", counters, repetitions);
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+/*
+ * Benchmark: in place byte order conversion of a file with io_uring and with the blocking pread/pwrite loop.
+ * The page cache of the file is dropped (best effort, posix_fadvise) before each run. Place the file on the device
+ * that should be measured.
+ *
+ * usage: bench_file_convert [directory] [size in MiB] [buffer size in KiB] [queue depth]
+ */
+
+#include "cxxendian/file_convert.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace cxxendian;
+
+int main(int argc, char **argv) {
+    const std::string dir   = argc > 1 ? argv[1] : "/tmp";
+    const std::size_t mib   = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 256;
+    const std::size_t kib   = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 1024;
+    const unsigned    depth = argc > 4 ? static_cast<unsigned>(std::atoi(argv[4])) : 8;
+
+    std::string path = dir + "/cxxendian_bench_XXXXXX";
+    const int   fd   = mkstemp(&path[0]);
+    if (fd < 0) {
+        std::perror("mkstemp");
+        return EXIT_FAILURE;
+    }
+    unlink(path.c_str());
+
+    // test data
+    std::vector<std::uint8_t> block(std::size_t(1) << 20);
+    for (std::size_t i = 0; i < block.size(); ++i)
+        block[i] = static_cast<std::uint8_t>(i * 13);
+    for (std::size_t i = 0; i < mib; ++i) {
+        if (pwrite(fd, block.data(), block.size(), static_cast<off_t>(i * block.size())) < 0) {
+            std::perror("pwrite");
+            return EXIT_FAILURE;
+        }
+    }
+    fsync(fd);
+
+    std::printf("%-12s %8s %8s %12s\n", "engine", "buffer", "depth", "MB/s");
+    for (bool uring : {true, false}) {
+        File_Convert_Params params;
+        params.buffer_bytes = kib * 1024;
+        params.queue_depth  = depth;
+        params.use_io_uring = uring;
+
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+
+        File_Convert_Stats stats;
+        const auto         start = std::chrono::steady_clock::now();
+        if (!swap_file<std::uint32_t>(fd, fd, params, &stats)) {
+            std::perror("swap_file");
+            return EXIT_FAILURE;
+        }
+        fdatasync(fd);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::printf("%-12s %7zuK %8u %12.1f\n",
+                    stats.io_uring ? "io_uring" : "pread",
+                    kib,
+                    uring ? depth : 1u,
+                    static_cast<double>(stats.bytes) / elapsed.count() / 1e6);
+    }
+
+    close(fd);
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+/*
+ * Benchmark: big endian floating point conversion.
+ * Compares the previous BE_Float layout (byte swapped value stored in and returned through a floating point variable)
+ * with the current layout (bit pattern in an unsigned integer) and with the bulk conversion of a packed array.
+ * Also reports the number of values that did not survive the round trip bit exactly (signaling NaNs).
+ *
+ * usage: bench_float [elements] [repetitions]
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/bulk.hpp"
+#include "cxxendian/packed.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace {
+
+volatile double sink;
+
+// hide the input from the optimizer, so the conversion is not hoisted out of the repetition loop
+template <typename T>
+T *opaque(T *p) {
+    T *volatile v = p;
+    return v;
+}
+
+// previous layout of BE_Float
+template <typename T>
+class Legacy_BE_Float final {
+    T data;
+
+public:
+    explicit Legacy_BE_Float(T v) noexcept : data(endian::host_to_big(v)) {}
+    virtual ~Legacy_BE_Float() = default;
+    virtual T get() const noexcept { return endian::host_to_big(data); }
+};
+
+template <typename F>
+double run(std::size_t bytes, std::size_t repetitions, F &&f) {
+    double     result = 0;
+    const auto start  = std::chrono::steady_clock::now();
+    for (std::size_t r = 0; r < repetitions; ++r)
+        result += static_cast<double>(f());
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    sink                                        = result;
+    return static_cast<double>(bytes) * static_cast<double>(repetitions) / elapsed.count() / 1e9;
+}
+
+template <typename T>
+std::size_t mismatches(const std::vector<T> &a, const std::vector<T> &b) {
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < a.size(); ++i)
+        n += std::memcmp(&a[i], &b[i], sizeof(T)) != 0;
+    return n;
+}
+
+template <typename T>
+void bench(const char *name, std::size_t n, std::size_t repetitions) {
+    using U = typename endian::detail::Uint_Of<sizeof(T)>::type;
+
+    // every 16th value is a signaling NaN with payload
+    std::vector<T> host(n), out(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        if (i % 16 == 0) {
+            const U snan = static_cast<U>(endian::detail::to_bits(std::numeric_limits<T>::infinity()) | (i % 255 + 1));
+            host[i]      = endian::detail::from_bits<T>(snan);
+        } else {
+            host[i] = static_cast<T>(i) * T(0.25);
+        }
+    }
+
+    std::vector<Legacy_BE_Float<T>>            legacy;
+    std::vector<cxxendian::BE_Float<T>>        current;
+    std::vector<cxxendian::Packed_BE_Float<T>> packed(n);
+    legacy.reserve(n);
+    current.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        legacy.emplace_back(host[i]);
+        current.emplace_back(host[i]);
+    }
+
+    const std::size_t bytes = n * sizeof(T);
+
+    const double legacy_decode = run(bytes, repetitions, [&] {
+        const auto *src = opaque(legacy.data());
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = src[i].get();
+        return out[n / 2];
+    });
+    const std::size_t legacy_bad = mismatches(host, out);
+
+    const double current_decode = run(bytes, repetitions, [&] {
+        const auto *src = opaque(current.data());
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = src[i].get();
+        return out[n / 2];
+    });
+    const std::size_t current_bad = mismatches(host, out);
+
+    const double legacy_encode  = run(bytes, repetitions, [&] {
+        const auto *src = opaque(host.data());
+        for (std::size_t i = 0; i < n; ++i)
+            legacy[i] = Legacy_BE_Float<T>(src[i]);
+        return legacy[n / 2].get();
+    });
+    const double current_encode = run(bytes, repetitions, [&] {
+        const auto *src = opaque(host.data());
+        for (std::size_t i = 0; i < n; ++i)
+            current[i] = src[i];
+        return current[n / 2].get();
+    });
+
+    const double bulk_decode = run(bytes, repetitions, [&] {
+        endian::big_to_host_n(opaque(packed.data()), out.data(), n);
+        return out[n / 2];
+    });
+    const double bulk_encode = run(bytes, repetitions, [&] {
+        endian::host_to_big_n(opaque(host.data()), packed.data(), n);
+        return packed[n / 2].get();
+    });
+    endian::big_to_host_n(packed.data(), out.data(), n);
+    const std::size_t bulk_bad = mismatches(host, out);
+
+    std::printf("%-8s %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f %6zu %6zu %6zu\n",
+                name,
+                legacy_decode,
+                current_decode,
+                bulk_decode,
+                legacy_encode,
+                current_encode,
+                bulk_encode,
+                legacy_bad,
+                current_bad,
+                bulk_bad);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::size_t n           = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 16;
+    const std::size_t repetitions = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 2000;
+
+    std::printf("GB/s of values, %zu elements; bad: values that changed in the round trip\n", n);
+    std::printf("%-8s %10s %10s %10s %10s %10s %10s %6s %6s %6s\n",
+                "type",
+                "dec old",
+                "dec new",
+                "dec bulk",
+                "enc old",
+                "enc new",
+                "enc bulk",
+                "bad o",
+                "bad n",
+                "bad b");
+    bench<float>("float", n, repetitions);
+    bench<double>("double", n, repetitions);
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+/*
+ * Benchmark: formatting of endian types for trace logs.
+ * Values: operator<< into a std::ostringstream, snprintf and to_chars (decimal and fixed width hexadecimal) of big
+ * endian values. Buffers: hexdump with field boundaries vs. a snprintf loop that produces the same text.
+ *
+ * usage: bench_format [elements] [repetitions]
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/format.hpp"
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+volatile char sink;
+
+// hide the input from the optimizer, so the conversion is not hoisted out of the repetition loop
+template <typename T>
+T *opaque(T *p) {
+    T *volatile v = p;
+    return v;
+}
+
+// million values (or MB of input) per second
+template <typename F>
+double run(std::size_t n, std::size_t repetitions, F &&f) {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t r = 0; r < repetitions; ++r)
+        sink = f();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(n) * static_cast<double>(repetitions) / elapsed.count() / 1e6;
+}
+
+template <typename T>
+void bench_values(const char *name, std::size_t n, std::size_t repetitions) {
+    std::mt19937_64                   rng(1);
+    std::vector<cxxendian::BE_Int<T>> values;
+    values.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+        values.emplace_back(static_cast<T>(rng() >> (rng() % 64)));
+
+    std::string out(n * 24, ' ');
+
+    const double stream = run(n, repetitions, [&] {
+        std::ostringstream s;
+        for (const auto &v : *opaque(&values))
+            s << v << ' ';
+        return s.str()[0];
+    });
+    const double print  = run(n, repetitions, [&] {
+        char *p = &out[0];
+        for (const auto &v : *opaque(&values))
+            p += std::snprintf(p, 24, "%" PRId64 " ", static_cast<std::int64_t>(v.get()));
+        return out[0];
+    });
+    const double chars  = run(n, repetitions, [&] {
+        char *p = &out[0];
+        for (const auto &v : *opaque(&values)) {
+            p    = cxxendian::to_chars(p, p + 24, v).ptr;
+            *p++ = ' ';
+        }
+        return out[0];
+    });
+    const double hex    = run(n, repetitions, [&] {
+        char *p = &out[0];
+        for (const auto &v : *opaque(&values)) {
+            p    = cxxendian::to_chars_hex(p, p + 24, v).ptr;
+            *p++ = ' ';
+        }
+        return out[0];
+    });
+
+    std::printf("%-10s %10.2f %10.2f %10.2f %10.2f\n", name, stream, print, chars, hex);
+}
+
+void bench_hexdump(std::size_t size, std::size_t repetitions) {
+    std::mt19937              rng(2);
+    std::vector<std::uint8_t> data(size);
+    for (auto &b : data)
+        b = static_cast<std::uint8_t>(rng());
+
+    // records of 12 bytes: uint16, uint16, uint32, uint32
+    const std::size_t              offsets[] = {0, 2, 4, 8};
+    const endian::Field_Boundaries fields {offsets, 4, 12};
+    std::string                    out(endian::hexdump_size(size) + 16, ' ');
+
+    const double print = run(size, repetitions, [&] {
+        const auto *s = opaque(data.data());
+        char       *p = &out[0];
+        for (std::size_t i = 0; i < size; ++i) {
+            if (i % 16 == 0) p += std::snprintf(p, 16, "%08x ", static_cast<unsigned>(i));
+            const std::size_t r        = i % 12;
+            const bool        boundary = r == 0 || r == 2 || r == 4 || r == 8;
+            p += std::snprintf(p, 8, "%c%02x", boundary ? '|' : ' ', s[i]);
+            if (i % 16 == 15 || i + 1 == size) *p++ = '\n';
+        }
+        return out[size / 2];
+    });
+    const double dump  = run(size, repetitions, [&] {
+        endian::hexdump(opaque(data.data()), size, &out[0], fields);
+        return out[size / 2];
+    });
+
+    std::printf("hexdump: snprintf %.2f MB/s, hexdump %.2f MB/s\n", print, dump);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::size_t n           = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 16;
+    const std::size_t repetitions = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100;
+
+    std::printf("million values/s, %zu elements\n", n);
+    std::printf("%-10s %10s %10s %10s %10s\n", "type", "ostream", "snprintf", "to_chars", "hex");
+    bench_values<std::int32_t>("int32", n, repetitions);
+    bench_values<std::int64_t>("int64", n, repetitions);
+    bench_hexdump(n * 4, repetitions);
+}
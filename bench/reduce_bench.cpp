@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+/*
+ * Benchmark: sum, maximum and dot product of a big endian column.
+ * Compares conversion into a temporary host order array followed by a scalar reduction with the fused reductions.
+ *
+ * usage: bench_reduce [elements] [repetitions]
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/bulk.hpp"
+#include "cxxendian/reduce.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <vector>
+
+using endian::Order;
+
+namespace {
+
+volatile double sink;
+
+// hide the input from the optimizer, so the reduction is not hoisted out of the repetition loop
+template <typename T>
+T *opaque(T *p) {
+    T *volatile v = p;
+    return v;
+}
+
+template <typename F>
+double run(std::size_t bytes, std::size_t repetitions, F &&f) {
+    double     result = 0;
+    const auto start  = std::chrono::steady_clock::now();
+    for (std::size_t r = 0; r < repetitions; ++r)
+        result += static_cast<double>(f());
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    sink                                        = result;
+    return static_cast<double>(bytes) * static_cast<double>(repetitions) / elapsed.count() / 1e9;
+}
+
+template <typename T>
+void bench(const char *name, std::size_t n, std::size_t repetitions) {
+    std::vector<T> host(n), other(n), tmp(n), tmp2(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        host[i]  = static_cast<T>(i % 1000);
+        other[i] = static_cast<T>(i % 7);
+    }
+    std::vector<std::uint8_t> wire(n * sizeof(T)), wire2(n * sizeof(T));
+    endian::host_to_big_n(host.data(), wire.data(), n);
+    endian::host_to_big_n(other.data(), wire2.data(), n);
+
+    const std::size_t bytes = n * sizeof(T);
+    using S                 = endian::Sum_Type<T>;
+
+    const double sum_copy  = run(bytes, repetitions, [&] {
+        endian::big_to_host_n(opaque(wire.data()), tmp.data(), n);
+        return std::accumulate(tmp.begin(), tmp.end(), S());
+    });
+    const double sum_fused = run(bytes, repetitions, [&] {
+        return endian::sum_n<Order::Big, T>(opaque(wire.data()), n);
+    });
+    const double sum_det   = run(bytes, repetitions, [&] {
+        return endian::sum_n<Order::Big, T>(opaque(wire.data()), n, endian::Reduce_Order::Deterministic);
+    });
+    const double max_copy  = run(bytes, repetitions, [&] {
+        endian::big_to_host_n(opaque(wire.data()), tmp.data(), n);
+        return *std::max_element(tmp.begin(), tmp.end());
+    });
+    const double max_fused = run(bytes, repetitions, [&] {
+        return endian::max_n<Order::Big, T>(opaque(wire.data()), n);
+    });
+    const double dot_copy  = run(2 * bytes, repetitions, [&] {
+        endian::big_to_host_n(opaque(wire.data()), tmp.data(), n);
+        endian::big_to_host_n(opaque(wire2.data()), tmp2.data(), n);
+        return std::inner_product(tmp.begin(), tmp.end(), tmp2.begin(), S());
+    });
+    const double dot_fused = run(2 * bytes, repetitions, [&] {
+        return endian::dot_n<Order::Big, T>(opaque(wire.data()), opaque(wire2.data()), n);
+    });
+
+    std::printf("%-10s %12.2f %12.2f %12.2f %12.2f %12.2f %12.2f %12.2f\n",
+                name,
+                sum_copy,
+                sum_fused,
+                sum_det,
+                max_copy,
+                max_fused,
+                dot_copy,
+                dot_fused);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::size_t n           = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 16;
+    const std::size_t repetitions = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 2000;
+
+    std::printf("GB/s of wire data, %zu elements\n", n);
+    std::printf("%-10s %12s %12s %12s %12s %12s %12s %12s\n",
+                "type",
+                "sum copy",
+                "sum fused",
+                "sum determ.",
+                "max copy",
+                "max fused",
+                "dot copy",
+                "dot fused");
+    bench<std::int16_t>("int16", n, repetitions);
+    bench<std::uint32_t>("uint32", n, repetitions);
+    bench<std::int64_t>("int64", n, repetitions);
+    bench<float>("float", n, repetitions);
+    bench<double>("double", n, repetitions);
+}
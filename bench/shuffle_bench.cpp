@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+/*
+ * Benchmark: byte plane split (shuffle filter) with byte order change.
+ * Compares a byte swap into a temporary array followed by the split (two passes) with the fused split, for both
+ * directions and the element widths 2, 4, 8 and 16. The plain split without byte order change is the upper bound.
+ *
+ * usage: bench_shuffle [elements] [repetitions]
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/bulk.hpp"
+#include "cxxendian/shuffle.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using endian::Order;
+
+namespace {
+
+volatile std::uint8_t sink;
+
+// hide the input from the optimizer, so the conversion is not hoisted out of the repetition loop
+template <typename T>
+T *opaque(T *p) {
+    T *volatile v = p;
+    return v;
+}
+
+template <typename F>
+double run(std::size_t bytes, std::size_t repetitions, F &&f) {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t r = 0; r < repetitions; ++r)
+        sink = f();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(bytes) * static_cast<double>(repetitions) / elapsed.count() / 1e9;
+}
+
+template <std::size_t W>
+struct Element {
+    std::uint8_t bytes[W];
+};
+
+template <std::size_t W>
+void bench(std::size_t n, std::size_t repetitions) {
+    using E = Element<W>;
+
+    const std::size_t bytes = n * W;
+    std::vector<E>    data(n), tmp(n);
+    std::vector<E>    out(n);
+    std::mt19937      rng(1);
+    for (auto &e : data)
+        for (auto &b : e.bytes)
+            b = static_cast<std::uint8_t>(rng());
+    std::vector<std::uint8_t> planes(bytes);
+
+    const double split_plain = run(bytes, repetitions, [&] {
+        endian::split_planes_n<Order::Big, Order::Big, W>(opaque(data.data()), planes.data(), n);
+        return planes[bytes / 2];
+    });
+    const double split_two   = run(bytes, repetitions, [&] {
+        endian::swap_n(opaque(data.data()), tmp.data(), n);
+        endian::split_planes_n<Order::Big, Order::Big, W>(tmp.data(), planes.data(), n);
+        return planes[bytes / 2];
+    });
+    const double split_fused = run(bytes, repetitions, [&] {
+        endian::split_planes_n<Order::Little, Order::Big, W>(opaque(data.data()), planes.data(), n);
+        return planes[bytes / 2];
+    });
+
+    const double merge_two   = run(bytes, repetitions, [&] {
+        endian::merge_planes_n<Order::Big, Order::Big, W>(opaque(planes.data()), tmp.data(), n);
+        endian::swap_n(tmp.data(), out.data(), n);
+        return out[n / 2].bytes[0];
+    });
+    const double merge_fused = run(bytes, repetitions, [&] {
+        endian::merge_planes_n<Order::Big, Order::Little, W>(opaque(planes.data()), out.data(), n);
+        return out[n / 2].bytes[0];
+    });
+
+    std::printf("%5zu %10.2f %10.2f %10.2f %10.2f %10.2f\n",
+                W,
+                split_plain,
+                split_two,
+                split_fused,
+                merge_two,
+                merge_fused);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::size_t n           = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 20;
+    const std::size_t repetitions = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 200;
+
+    std::printf("GB/s, %zu elements; two pass: swap_n and split/merge without byte order change\n", n);
+    std::printf("%5s %10s %10s %10s %10s %10s\n", "width", "split", "split 2p", "split fus", "merge 2p", "merge fus");
+    bench<2>(n, repetitions);
+    bench<4>(n, repetitions);
+    bench<8>(n, repetitions);
+    bench<16>(n, repetitions);
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+/*
+ * Benchmark: sort a big endian key array.
+ * Compares conversion to host order, std::sort and conversion back with the radix sort on the wire order data
+ * (one thread and all hardware threads).
+ *
+ * usage: bench_sort [elements] [repetitions]
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/bulk.hpp"
+#include "cxxendian/sort.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+using endian::Order;
+
+namespace {
+
+volatile std::uint8_t sink;
+
+// elements per second in millions; the input is restored before every repetition (not measured)
+template <typename F>
+double run(std::size_t n, std::size_t repetitions, const std::vector<std::uint8_t> &input,
+           std::vector<std::uint8_t> &data, F &&f) {
+    std::chrono::duration<double> elapsed {0};
+    for (std::size_t r = 0; r < repetitions; ++r) {
+        data             = input;
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        elapsed += std::chrono::steady_clock::now() - start;
+        sink = data[data.size() / 2];
+    }
+    return static_cast<double>(n) * static_cast<double>(repetitions) / elapsed.count() / 1e6;
+}
+
+template <typename T>
+void bench(const char *name, std::size_t n, std::size_t repetitions, unsigned threads) {
+    std::mt19937_64 rng(1);
+    std::vector<T>  host(n), tmp(n);
+    for (auto &v : host) {
+        if constexpr (std::is_floating_point<T>::value) v = static_cast<T>(static_cast<double>(rng()) * 1e-9 - 9e9);
+        else v = static_cast<T>(rng());
+    }
+    std::vector<std::uint8_t> input(n * sizeof(T)), data;
+    endian::host_to_big_n(host.data(), input.data(), n);
+
+    const double copy  = run(n, repetitions, input, data, [&] {
+        endian::big_to_host_n(data.data(), tmp.data(), n);
+        std::sort(tmp.begin(), tmp.end());
+        endian::host_to_big_n(tmp.data(), data.data(), n);
+    });
+    const double radix = run(n, repetitions, input, data, [&] {
+        endian::radix_sort_n<Order::Big, T>(data.data(), n);
+    });
+    const double par   = run(n, repetitions, input, data, [&] {
+        endian::radix_sort_n<Order::Big, T>(data.data(), n, threads);
+    });
+
+    std::printf("%-10s %14.2f %14.2f %14.2f\n", name, copy, radix, par);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::size_t n           = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 22;
+    const std::size_t repetitions = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10;
+    const unsigned    threads     = std::max(1u, std::thread::hardware_concurrency());
+
+    std::printf("million elements/s, %zu elements, %u threads\n", n, threads);
+    std::printf("%-10s %14s %14s %14s\n", "type", "std::sort copy", "radix", "radix parallel");
+    bench<std::uint32_t>("uint32", n, repetitions, threads);
+    bench<std::int64_t>("int64", n, repetitions, threads);
+    bench<float>("float", n, repetitions, threads);
+    bench<double>("double", n, repetitions, threads);
+}
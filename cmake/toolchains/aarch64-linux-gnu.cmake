@@ -0,0 +1,36 @@
+#
+# Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+# This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+#
+
+# Cross build for AArch64 (NEON) with the tests running in qemu user mode.
+#
+# requirements (Debian/Ubuntu): g++-aarch64-linux-gnu qemu-user
+#
+# usage:
+#   cmake -B build-aarch64 -DCMAKE_TOOLCHAIN_FILE=cmake/toolchains/aarch64-linux-gnu.cmake -DCLANG_FORMAT=OFF
+#   cmake --build build-aarch64
+#   ctest --test-dir build-aarch64
+#
+# Set AARCH64_SVE=ON to build the SVE kernels (qemu emulates a CPU with SVE).
+
+set(CMAKE_SYSTEM_NAME Linux)
+set(CMAKE_SYSTEM_PROCESSOR aarch64)
+
+set(CROSS_TRIPLE aarch64-linux-gnu)
+set(CMAKE_CXX_COMPILER ${CROSS_TRIPLE}-g++)
+
+option(AARCH64_SVE "build for AArch64 with SVE" OFF)
+if(AARCH64_SVE)
+    set(CMAKE_CXX_FLAGS_INIT "-march=armv8.2-a+sve")
+else()
+    set(CMAKE_CXX_FLAGS_INIT "-march=armv8-a")
+endif()
+
+set(CMAKE_FIND_ROOT_PATH /usr/${CROSS_TRIPLE})
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
+
+# ctest runs all test executables with this emulator (cpu max: all extensions including SVE)
+set(CMAKE_CROSSCOMPILING_EMULATOR qemu-aarch64 -cpu max -L /usr/${CROSS_TRIPLE})
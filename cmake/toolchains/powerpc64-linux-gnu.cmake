@@ -0,0 +1,30 @@
+#
+# Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+# This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+#
+
+# Cross build for ppc64 (big endian) with the tests running in qemu user mode.
+#
+# requirements (Debian/Ubuntu): g++-powerpc64-linux-gnu qemu-user
+#
+# usage:
+#   cmake -B build-ppc64 -DCMAKE_TOOLCHAIN_FILE=cmake/toolchains/powerpc64-linux-gnu.cmake -DCLANG_FORMAT=OFF
+#   cmake --build build-ppc64
+#   ctest --test-dir build-ppc64
+
+set(CMAKE_SYSTEM_NAME Linux)
+set(CMAKE_SYSTEM_PROCESSOR ppc64)
+
+set(CROSS_TRIPLE powerpc64-linux-gnu)
+set(CMAKE_CXX_COMPILER ${CROSS_TRIPLE}-g++)
+
+# POWER8: VSX (used by the bulk conversion kernels)
+set(CMAKE_CXX_FLAGS_INIT "-mcpu=power8 -mvsx")
+
+set(CMAKE_FIND_ROOT_PATH /usr/${CROSS_TRIPLE})
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
+
+# ctest runs all test executables with this emulator
+set(CMAKE_CROSSCOMPILING_EMULATOR qemu-ppc64 -cpu power8 -L /usr/${CROSS_TRIPLE})
@@ -0,0 +1,30 @@
+#
+# Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+# This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+#
+
+# Cross build for s390x (big endian) with the tests running in qemu user mode.
+#
+# requirements (Debian/Ubuntu): g++-s390x-linux-gnu qemu-user
+#
+# usage:
+#   cmake -B build-s390x -DCMAKE_TOOLCHAIN_FILE=cmake/toolchains/s390x-linux-gnu.cmake -DCLANG_FORMAT=OFF
+#   cmake --build build-s390x
+#   ctest --test-dir build-s390x
+
+set(CMAKE_SYSTEM_NAME Linux)
+set(CMAKE_SYSTEM_PROCESSOR s390x)
+
+set(CROSS_TRIPLE s390x-linux-gnu)
+set(CMAKE_CXX_COMPILER ${CROSS_TRIPLE}-g++)
+
+# z13 introduced the vector facility (used by the bulk conversion kernels)
+set(CMAKE_CXX_FLAGS_INIT "-march=z13 -mzvector")
+
+set(CMAKE_FIND_ROOT_PATH /usr/${CROSS_TRIPLE})
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
+
+# ctest runs all test executables with this emulator
+set(CMAKE_CROSSCOMPILING_EMULATOR qemu-s390x -L /usr/${CROSS_TRIPLE})
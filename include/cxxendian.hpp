@@ -5,6 +5,12 @@
 
 #pragma once
 
+/*
+ * Core endian types and their operators. The bulk, stream, serialization, columnar and other array level facilities
+ * are not included here to keep the compile time of translation units that only use the types low; include the
+ * corresponding header from cxxendian/ where they are needed (e.g. "cxxendian/bulk.hpp").
+ */
+
 #include "cxxendian/base_int.hpp"
 #include "cxxendian/int.hpp"
 #include "cxxendian/int_operators.hpp"
@@ -12,3 +18,5 @@
 #include "cxxendian/base_float.hpp"
 #include "cxxendian/float.hpp"
 #include "cxxendian/float_operators.hpp"
+
+#include "cxxendian/extern_templates.hpp"
@@ -0,0 +1,466 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "bulk.hpp"
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace cxxendian {
+
+//* alignment of all arena and pool allocations (size of a cache line)
+constexpr std::size_t CACHE_LINE = 64;
+
+namespace detail {
+
+inline void *aligned_new(std::size_t bytes) {
+    return ::operator new(bytes, std::align_val_t(CACHE_LINE));
+}
+
+inline void aligned_delete(void *p) noexcept {
+    ::operator delete(p, std::align_val_t(CACHE_LINE));
+}
+
+constexpr std::size_t align_up(std::size_t v, std::size_t align) noexcept {
+    return (v + align - 1) & ~(align - 1);
+}
+
+}  // namespace detail
+
+/**
+ * @brief monotonic allocator for conversion scratch space
+ * @details
+ * Memory is taken from large blocks by incrementing an offset. Individual allocations are never freed. Instead the
+ * arena is rewound to a previous state (see mark, rewind and Arena_Scope) or reset completely, e.g. after each
+ * message. The blocks are kept and reused, so a steady state needs no calls to the system allocator.
+ *
+ * All allocations are cache line aligned by default. An arena is not thread safe, use one arena per thread
+ * (see thread_arena).
+ */
+class Arena {
+    struct Block {
+        std::uint8_t *mem;
+        std::size_t   size;
+    };
+
+    std::vector<Block> blocks;
+    std::size_t        current = 0;  // index of the block that is used for allocations
+    std::size_t        offset  = 0;  // first free byte in this block
+    std::size_t        block_size;
+
+#if defined(__GNUC__) || defined(__clang__)
+    __attribute__((noinline))
+#endif
+    void *allocate_slow(std::size_t bytes, std::size_t align) {
+        // reuse a following block if it is large enough
+        for (std::size_t i = blocks.empty() ? 0 : current + 1; i < blocks.size(); ++i) {
+            if (blocks[i].size >= bytes) {
+                current = i;
+                offset  = bytes;
+                return blocks[i].mem;
+            }
+        }
+
+        const std::size_t size = bytes > block_size ? detail::align_up(bytes, align) : block_size;
+        blocks.push_back({static_cast<std::uint8_t *>(detail::aligned_new(size)), size});
+        current = blocks.size() - 1;
+        offset  = bytes;
+        return blocks.back().mem;
+    }
+
+public:
+    //* position of an arena (see mark and rewind)
+    struct Marker {
+        //* block index
+        std::size_t block;
+        //* offset in the block
+        std::size_t offset;
+    };
+
+    /**
+     * @brief create arena (no allocation)
+     * @param block_bytes size of a block in bytes (larger allocations get their own block)
+     */
+    explicit Arena(std::size_t block_bytes = 64 * 1024) noexcept
+            : block_size(detail::align_up(block_bytes ? block_bytes : 1, CACHE_LINE)) {}
+
+    Arena(const Arena &)            = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    //* free all blocks
+    ~Arena() { release(); }
+
+    /**
+     * @brief allocate memory
+     * @param bytes number of bytes
+     * @param align alignment (power of two, at most CACHE_LINE)
+     * @return pointer to the memory (valid until the arena is rewound before this allocation)
+     * @exception std::bad_alloc allocation of a new block failed
+     */
+    inline void *allocate(std::size_t bytes, std::size_t align = CACHE_LINE) {
+        if (!blocks.empty()) {
+            const std::size_t start = detail::align_up(offset, align);
+            if (start + bytes <= blocks[current].size) {
+                offset = start + bytes;
+                return blocks[current].mem + start;
+            }
+        }
+        return allocate_slow(bytes, align);
+    }
+
+    /**
+     * @brief allocate array
+     * @tparam T element type (trivial types only, no constructor is called)
+     * @param n number of elements
+     * @return pointer to the first element
+     * @exception std::bad_alloc allocation of a new block failed
+     */
+    template <typename T>
+    inline T *allocate(std::size_t n) {
+        static_assert(std::is_trivial<T>::value, "Arena::allocate requires a trivial type");
+        static_assert(alignof(T) <= CACHE_LINE, "over aligned types are not supported");
+        return static_cast<T *>(allocate(n * sizeof(T)));
+    }
+
+    //* current position
+    inline Marker mark() const noexcept { return {current, offset}; }
+
+    /**
+     * @brief free all allocations since a mark
+     * @param m position returned by mark
+     */
+    inline void rewind(Marker m) noexcept {
+        current = m.block;
+        offset  = m.offset;
+    }
+
+    //* free all allocations (the blocks are kept)
+    inline void reset() noexcept { rewind({0, 0}); }
+
+    //* free all allocations and blocks
+    void release() noexcept {
+        for (auto &b : blocks)
+            detail::aligned_delete(b.mem);
+        blocks.clear();
+        current = offset = 0;
+    }
+
+    //* total size of all blocks in bytes
+    std::size_t capacity() const noexcept {
+        std::size_t sum = 0;
+        for (const auto &b : blocks)
+            sum += b.size;
+        return sum;
+    }
+};
+
+/**
+ * @brief size class pool for conversion scratch space
+ * @details
+ * Allocations are rounded up to a power of two (at least CACHE_LINE, at most MAX_SIZE bytes) and served from a free
+ * list per size class. Freed memory is returned to its free list and reused by the next allocation of the same class.
+ * New memory is taken from an internal arena. Larger allocations are forwarded to the system allocator.
+ *
+ * In contrast to Arena, allocations can be freed individually. A pool is not thread safe, use one pool per thread
+ * (see thread_pool).
+ */
+class Pool {
+public:
+    //* largest size class in bytes
+    static constexpr std::size_t MAX_SIZE = std::size_t(1) << 20;
+
+private:
+    static constexpr std::size_t MIN_SHIFT = 6;  // CACHE_LINE
+    static constexpr std::size_t CLASSES   = 15;  // 64 B ... 1 MiB
+
+    struct Node {
+        Node *next;
+    };
+
+    Arena arena;
+    Node *free_lists[CLASSES] = {};
+
+    static inline std::size_t size_class(std::size_t bytes) noexcept {
+        if (bytes <= CACHE_LINE) return 0;
+#if defined(__GNUC__) || defined(__clang__)
+        constexpr std::size_t BITS = 8 * sizeof(unsigned long long);
+        return BITS - static_cast<std::size_t>(__builtin_clzll(static_cast<unsigned long long>(bytes - 1))) - MIN_SHIFT;
+#else
+        std::size_t c = 0;
+        while ((CACHE_LINE << c) < bytes)
+            ++c;
+        return c;
+#endif
+    }
+
+public:
+    /**
+     * @brief create pool (no allocation)
+     * @param block_bytes size of the blocks of the internal arena
+     */
+    explicit Pool(std::size_t block_bytes = 256 * 1024) noexcept : arena(block_bytes) {}
+
+    Pool(const Pool &)            = delete;
+    Pool &operator=(const Pool &) = delete;
+
+    /**
+     * @brief allocate memory
+     * @param bytes number of bytes
+     * @return cache line aligned pointer to the memory
+     * @exception std::bad_alloc allocation failed
+     */
+    inline void *allocate(std::size_t bytes) {
+        if (bytes > MAX_SIZE) return detail::aligned_new(bytes);
+
+        const std::size_t c = size_class(bytes);
+        if (Node *n = free_lists[c]) {
+            free_lists[c] = n->next;
+            return n;
+        }
+        return arena.allocate(CACHE_LINE << c);
+    }
+
+    /**
+     * @brief free memory
+     * @param p pointer returned by allocate
+     * @param bytes size that was passed to allocate
+     */
+    inline void deallocate(void *p, std::size_t bytes) noexcept {
+        if (!p) return;
+        if (bytes > MAX_SIZE) {
+            detail::aligned_delete(p);
+            return;
+        }
+
+        const std::size_t c = size_class(bytes);
+        Node             *n = ::new (p) Node {free_lists[c]};
+        free_lists[c]       = n;
+    }
+
+    /**
+     * @brief allocate array
+     * @tparam T element type (trivial types only, no constructor is called)
+     * @param n number of elements
+     * @return pointer to the first element
+     * @exception std::bad_alloc allocation failed
+     */
+    template <typename T>
+    inline T *allocate(std::size_t n) {
+        static_assert(std::is_trivial<T>::value, "Pool::allocate requires a trivial type");
+        static_assert(alignof(T) <= CACHE_LINE, "over aligned types are not supported");
+        return static_cast<T *>(allocate(n * sizeof(T)));
+    }
+
+    /**
+     * @brief free array
+     * @tparam T element type
+     * @param p pointer returned by allocate<T>
+     * @param n number of elements that was passed to allocate<T>
+     */
+    template <typename T>
+    inline void deallocate(T *p, std::size_t n) noexcept {
+        deallocate(static_cast<void *>(p), n * sizeof(T));
+    }
+
+    //* free all allocations at once (all pointers of this pool become invalid)
+    void reset() noexcept {
+        for (auto &l : free_lists)
+            l = nullptr;
+        arena.reset();
+    }
+};
+
+/**
+ * @brief arena of the current thread
+ * @return thread local arena
+ */
+inline Arena &thread_arena() {
+    thread_local Arena arena;
+    return arena;
+}
+
+/**
+ * @brief pool of the current thread
+ * @return thread local pool
+ */
+inline Pool &thread_pool() {
+    thread_local Pool pool;
+    return pool;
+}
+
+/**
+ * @brief rewinds an arena when leaving the scope (e.g. per message)
+ * @details
+ * @code
+ * void on_message(const uint8_t *buf, size_t n) {
+ *     cxxendian::Arena_Scope scope;  // thread_arena()
+ *     const uint32_t *values = cxxendian::to_host_scratch<endian::Order::Big, uint32_t>(buf, n / 4);
+ *     process(values, n / 4);
+ * }  // memory of values is reused by the next message
+ * @endcode
+ */
+class Arena_Scope {
+    Arena        &arena;
+    Arena::Marker marker;
+
+public:
+    /**
+     * @brief remember the current position of an arena
+     * @param a arena
+     */
+    explicit Arena_Scope(Arena &a = thread_arena()) noexcept : arena(a), marker(a.mark()) {}
+
+    Arena_Scope(const Arena_Scope &)            = delete;
+    Arena_Scope &operator=(const Arena_Scope &) = delete;
+
+    //* free all allocations of the scope
+    ~Arena_Scope() { arena.rewind(marker); }
+};
+
+/**
+ * @brief standard allocator that allocates from an Arena
+ * @details deallocate does nothing, the memory is freed by rewinding or resetting the arena.
+ * Can be used with containers and with Writer (e.g. Writer<endian::Order::Big, Arena_Allocator<std::uint8_t>>).
+ * @tparam T value type
+ */
+template <typename T>
+class Arena_Allocator {
+    template <typename U>
+    friend class Arena_Allocator;
+
+    Arena *arena;
+
+public:
+    using value_type = T;
+
+    /**
+     * @brief create allocator
+     * @param a arena (must outlive the allocator and all allocations)
+     */
+    explicit Arena_Allocator(Arena &a = thread_arena()) noexcept : arena(&a) {}
+
+    /**
+     * @brief rebind constructor
+     * @param other allocator of other value type
+     */
+    template <typename U>
+    Arena_Allocator(const Arena_Allocator<U> &other) noexcept : arena(other.arena) {}
+
+    /**
+     * @brief allocate memory
+     * @param n number of elements
+     * @return cache line aligned memory
+     */
+    T *allocate(std::size_t n) { return static_cast<T *>(arena->allocate(n * sizeof(T))); }
+
+    //* no operation
+    void deallocate(T *, std::size_t) noexcept {}
+
+    template <typename U>
+    bool operator==(const Arena_Allocator<U> &other) const noexcept {
+        return arena == other.arena;
+    }
+
+    template <typename U>
+    bool operator!=(const Arena_Allocator<U> &other) const noexcept {
+        return arena != other.arena;
+    }
+};
+
+/**
+ * @brief standard allocator that allocates from a Pool
+ * @tparam T value type
+ */
+template <typename T>
+class Pool_Allocator {
+    template <typename U>
+    friend class Pool_Allocator;
+
+    Pool *pool;
+
+public:
+    using value_type = T;
+
+    /**
+     * @brief create allocator
+     * @param p pool (must outlive the allocator and all allocations)
+     */
+    explicit Pool_Allocator(Pool &p = thread_pool()) noexcept : pool(&p) {}
+
+    /**
+     * @brief rebind constructor
+     * @param other allocator of other value type
+     */
+    template <typename U>
+    Pool_Allocator(const Pool_Allocator<U> &other) noexcept : pool(other.pool) {}
+
+    /**
+     * @brief allocate memory
+     * @param n number of elements
+     * @return cache line aligned memory
+     */
+    T *allocate(std::size_t n) { return static_cast<T *>(pool->allocate(n * sizeof(T))); }
+
+    /**
+     * @brief free memory
+     * @param p memory returned by allocate
+     * @param n number of elements that was passed to allocate
+     */
+    void deallocate(T *p, std::size_t n) noexcept { pool->deallocate(p, n * sizeof(T)); }
+
+    template <typename U>
+    bool operator==(const Pool_Allocator<U> &other) const noexcept {
+        return pool == other.pool;
+    }
+
+    template <typename U>
+    bool operator!=(const Pool_Allocator<U> &other) const noexcept {
+        return pool != other.pool;
+    }
+};
+
+/**
+ * @brief convert an array to host byte order into arena memory
+ * @tparam order byte order of the source
+ * @tparam T base data type (integer or floating point)
+ * @param src source (n * sizeof(T) bytes)
+ * @param n number of elements
+ * @param arena arena that provides the memory
+ * @return cache line aligned array in host byte order (valid until the arena is rewound)
+ * @exception std::bad_alloc allocation of a new block failed
+ */
+template <endian::Order order, typename T>
+inline T *to_host_scratch(const void *src, std::size_t n, Arena &arena = thread_arena()) {
+    T *dst = arena.allocate<T>(n);
+    endian::to_host_n<order>(src, dst, n);
+    return dst;
+}
+
+/**
+ * @brief convert an array from host byte order into arena memory
+ * @tparam order byte order of the destination
+ * @tparam T base data type (integer or floating point)
+ * @param src values in host byte order
+ * @param n number of elements
+ * @param arena arena that provides the memory
+ * @return cache line aligned buffer with n * sizeof(T) bytes in byte order order (valid until the arena is rewound)
+ * @exception std::bad_alloc allocation of a new block failed
+ */
+template <endian::Order order, typename T>
+inline std::uint8_t *from_host_scratch(const T *src, std::size_t n, Arena &arena = thread_arena()) {
+    auto *dst = arena.allocate<std::uint8_t>(n * sizeof(T));
+    endian::from_host_n<order>(src, dst, n);
+    return dst;
+}
+
+}  // namespace cxxendian
@@ -8,6 +8,9 @@
 #include <cstddef>
 #include <type_traits>
 
+#include "endian.hpp"
+#include "fwd.hpp"
+
 /**
  * @brief namespace for all members of the cxxendian library
  */
@@ -15,20 +18,28 @@ namespace cxxendian {
 
 /**
  * @brief abstract base class for storing floating point values
+ * @details
+ * The value is stored as bit pattern in an unsigned integer of the same size. Byte swapped values never pass through
+ * floating point registers, which may quiet signaling NaNs (x87) and prevent the use of integer byte swap
+ * instructions. Conversions are bit exact (NaN payloads are preserved).
  *
  * @tparam T data type (floating point only)
  */
-template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
+template <typename T, typename>
 class Base_Float {
+public:
+    //* unsigned integer type that holds the bit pattern
+    using Raw = typename endian::detail::Uint_Of<sizeof(T)>::type;
+
 protected:
-    //* the actual data is stored her
-    T data;
+    //* the actual data is stored here (bit pattern in the endianness of the object)
+    Raw data;
 
     /**
-     * @brief create instance from base data type
-     * @param v data for initialization
+     * @brief create instance from a bit pattern
+     * @param raw bit pattern in the endianness of the object
      */
-    explicit Base_Float(T v) noexcept : data(v) {}
+    explicit Base_Float(Raw raw) noexcept : data(raw) {}
 
     /**
      * @brief copy constructor
@@ -36,6 +47,13 @@ protected:
      */
     explicit Base_Float(const Base_Float<T> &other) noexcept : data(other.data) {}
 
+    /**
+     * @brief copy assignment
+     * @param other other instance
+     * @return this instance
+     */
+    Base_Float &operator=(const Base_Float &other) noexcept = default;
+
 public:
     //* default destructor
     virtual ~Base_Float() = default;
@@ -46,17 +64,37 @@ public:
      */
     virtual T get() const noexcept = 0;
 
+    /**
+     * @brief set the value
+     * @param v value in host endian
+     */
+    virtual void set(T v) noexcept = 0;
+
+    /**
+     * @brief get the bit pattern of the value in host endian
+     * @details Used for conversions between the byte orders: the value is copied as integer and never returned in a
+     * floating point register (which quiets signaling NaNs on x87).
+     * @return bit pattern in host endian
+     */
+    virtual Raw get_bits() const noexcept = 0;
+
+    /**
+     * @brief set the value from its bit pattern
+     * @param bits bit pattern in host endian
+     */
+    virtual void set_bits(Raw bits) noexcept = 0;
+
     /**
      * @brief access raw data (for internal use only)
-     * @return raw data
+     * @return bit pattern in the endianness of the object
      */
-    inline T &get_raw() noexcept { return data; }
+    inline Raw &get_raw() noexcept { return data; }
 
     /**
      * @brief get copy of raw data (for internal use only)
-     * @return raw data
+     * @return bit pattern in the endianness of the object
      */
-    inline T get_raw() const noexcept { return data; }
+    inline Raw get_raw() const noexcept { return data; }
 };
 
 }  // namespace cxxendian
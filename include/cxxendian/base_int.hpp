@@ -8,6 +8,8 @@
 #include <cstddef>
 #include <type_traits>
 
+#include "fwd.hpp"
+
 /**
  * @brief namespace for all members of the cxxendian library
  */
@@ -18,7 +20,7 @@ namespace cxxendian {
  *
  * @tparam T data type (floating point only)
  */
-template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
+template <typename T, typename>
 class Base_Int {
 protected:
     //* the actual data is stored her
@@ -36,6 +38,13 @@ protected:
      */
     explicit Base_Int(const Base_Int<T> &other) noexcept : data(other.data) {}
 
+    /**
+     * @brief copy assignment
+     * @param other other instance
+     * @return this instance
+     */
+    Base_Int &operator=(const Base_Int &other) noexcept = default;
+
 public:
     //* default destructor
     virtual ~Base_Int() = default;
@@ -46,6 +55,12 @@ public:
      */
     virtual T get() const noexcept = 0;
 
+    /**
+     * @brief set the value
+     * @param v value in host endian
+     */
+    virtual void set(T v) noexcept = 0;
+
     /**
      * @brief access raw data (for internal use only)
      * @return raw data
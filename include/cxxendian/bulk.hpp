@@ -0,0 +1,677 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "endian.hpp"
+
+#if !defined(CXXENDIAN_NO_SIMD)
+#    if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#        define CXXENDIAN_HAVE_SSE2
+#    endif
+#    if defined(__SSSE3__)
+#        define CXXENDIAN_HAVE_SSSE3
+#    endif
+#    if defined(__AVX2__)
+#        define CXXENDIAN_HAVE_AVX2
+#    endif
+#    if defined(__AVX512F__) && defined(__AVX512BW__)
+#        define CXXENDIAN_HAVE_AVX512
+#    endif
+#    if defined(__VSX__) && defined(__ALTIVEC__)
+#        define CXXENDIAN_HAVE_VSX
+#    endif
+#    if defined(__s390x__) && defined(__VEC__)
+#        define CXXENDIAN_HAVE_ZVECTOR
+#    endif
+#    if defined(__ARM_NEON) && defined(__aarch64__)
+#        define CXXENDIAN_HAVE_NEON
+#    endif
+#    if defined(__ARM_FEATURE_SVE)
+#        define CXXENDIAN_HAVE_SVE
+#    endif
+#endif
+
+#if defined(CXXENDIAN_HAVE_SSE2)
+#    include <immintrin.h>
+#endif
+
+#if defined(CXXENDIAN_HAVE_VSX)
+#    include <altivec.h>
+// altivec.h may define these as macros (context sensitive keywords are used instead)
+#    undef vector
+#    undef pixel
+#    undef bool
+#endif
+
+#if defined(CXXENDIAN_HAVE_ZVECTOR)
+#    include <vecintrin.h>
+#endif
+
+#if defined(CXXENDIAN_HAVE_NEON)
+#    include <arm_neon.h>
+#endif
+
+#if defined(CXXENDIAN_HAVE_SVE)
+#    include <arm_sve.h>
+#endif
+
+#if !defined(CXXENDIAN_STREAM_THRESHOLD)
+/**
+ * @brief output size in bytes from which the bulk conversion uses non-temporal stores
+ * @details Outputs of this size are assumed to be larger than the last level cache. Writing them through the cache
+ * would only evict the working set of the caller. Define before including to override.
+ */
+#    define CXXENDIAN_STREAM_THRESHOLD (std::size_t(16) << 20)
+#endif
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace endian {
+
+/**
+ * @brief implementation details (not part of the public api)
+ */
+namespace detail {
+
+/**
+ * @brief scalar byte swap of n elements with W bytes each
+ * @details src and dst may be identical
+ */
+template <std::size_t W>
+inline void swap_scalar(const std::uint8_t *src, std::uint8_t *dst, std::size_t n) noexcept {
+    if constexpr (W == 1) {
+        if (n && src != dst) std::memmove(dst, src, n);
+    } else if constexpr (W == 2 || W == 4 || W == 8) {
+        using U = typename Uint_Of<W>::type;
+        for (std::size_t i = 0; i < n; ++i) {
+            U v;
+            std::memcpy(&v, src + i * W, W);
+            v = bswap(v);
+            std::memcpy(dst + i * W, &v, W);
+        }
+    } else {
+        for (std::size_t i = 0; i < n; ++i) {
+            std::uint8_t tmp[W];
+            for (std::size_t j = 0; j < W; ++j)
+                tmp[j] = src[i * W + W - 1 - j];
+            std::memcpy(dst + i * W, tmp, W);
+        }
+    }
+}
+
+#if defined(CXXENDIAN_HAVE_SSE2)
+/**
+ * @brief reverse the bytes of each W byte lane of a 128 bit vector
+ */
+template <std::size_t W>
+inline __m128i swap_vec(__m128i v) noexcept {
+#    if defined(CXXENDIAN_HAVE_SSSE3)
+    alignas(16) std::uint8_t mask[16];
+    for (std::size_t j = 0; j < 16; ++j)
+        mask[j] = static_cast<std::uint8_t>((j / W) * W + (W - 1 - j % W));
+    return _mm_shuffle_epi8(v, _mm_load_si128(reinterpret_cast<const __m128i *>(mask)));
+#    else
+    // SSE2 only: swap bytes in 16 bit words, then reorder the words
+    v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+    if constexpr (W == 4) {
+        v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+    } else if constexpr (W == 8 || W == 16) {
+        v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3));
+        if constexpr (W == 16) v = _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+    }
+    return v;
+#    endif
+}
+#endif
+
+#if defined(CXXENDIAN_HAVE_AVX2)
+/**
+ * @brief reverse the bytes of each W byte lane of a 256 bit vector
+ */
+template <std::size_t W>
+inline __m256i swap_vec(__m256i v) noexcept {
+    // the shuffle works within 128 bit lanes, W divides 16, so the lane pattern repeats
+    alignas(32) std::uint8_t mask[32];
+    for (std::size_t j = 0; j < 32; ++j)
+        mask[j] = static_cast<std::uint8_t>((j % 16 / W) * W + (W - 1 - j % W));
+    return _mm256_shuffle_epi8(v, _mm256_load_si256(reinterpret_cast<const __m256i *>(mask)));
+}
+#endif
+
+#if defined(CXXENDIAN_HAVE_AVX512)
+/**
+ * @brief reverse the bytes of each W byte lane of a 512 bit vector
+ */
+template <std::size_t W>
+inline __m512i swap_vec(__m512i v) noexcept {
+    alignas(64) std::uint8_t mask[64];
+    for (std::size_t j = 0; j < 64; ++j)
+        mask[j] = static_cast<std::uint8_t>((j % 16 / W) * W + (W - 1 - j % W));
+    return _mm512_shuffle_epi8(v, _mm512_load_si512(mask));
+}
+#endif
+
+#if defined(CXXENDIAN_HAVE_VSX) || defined(CXXENDIAN_HAVE_ZVECTOR)
+/**
+ * @brief reverse the bytes of each W byte lane of a 128 bit vector (POWER VSX, z/Architecture vector facility)
+ * @details vec_perm numbers the elements in memory order on big and little endian targets.
+ */
+template <std::size_t W>
+inline __vector unsigned char swap_vec(__vector unsigned char v) noexcept {
+    alignas(16) unsigned char mask[16];
+    for (std::size_t j = 0; j < 16; ++j)
+        mask[j] = static_cast<unsigned char>((j / W) * W + (W - 1 - j % W));
+    return vec_perm(v, v, vec_xl(0, mask));
+}
+#endif
+
+#if defined(CXXENDIAN_HAVE_NEON)
+/**
+ * @brief reverse the bytes of each W byte lane of a 128 bit vector (AArch64 NEON)
+ */
+template <std::size_t W>
+inline uint8x16_t swap_vec(uint8x16_t v) noexcept {
+    if constexpr (W == 2) {
+        return vrev16q_u8(v);
+    } else if constexpr (W == 4) {
+        return vrev32q_u8(v);
+    } else if constexpr (W == 8) {
+        return vrev64q_u8(v);
+    } else {
+        v = vrev64q_u8(v);
+        return vextq_u8(v, v, 8);
+    }
+}
+#endif
+
+#if defined(CXXENDIAN_HAVE_SVE)
+/**
+ * @brief byte swap of n elements with W bytes each (SVE, vector length agnostic)
+ * @details The predicated loop also handles the tail, no scalar epilogue is required. SVE loads and stores do not
+ * require element alignment.
+ */
+template <std::size_t W>
+inline void swap_bytes_sve(const std::uint8_t *s, std::uint8_t *d, std::size_t n) noexcept {
+    const std::uint64_t count = n;
+    if constexpr (W == 2) {
+        const auto *src = reinterpret_cast<const std::uint16_t *>(s);
+        auto       *dst = reinterpret_cast<std::uint16_t *>(d);
+        for (std::uint64_t i = 0; i < count; i += svcnth()) {
+            const svbool_t pg = svwhilelt_b16_u64(i, count);
+            svst1_u16(pg, dst + i, svrevb_u16_x(pg, svld1_u16(pg, src + i)));
+        }
+    } else if constexpr (W == 4) {
+        const auto *src = reinterpret_cast<const std::uint32_t *>(s);
+        auto       *dst = reinterpret_cast<std::uint32_t *>(d);
+        for (std::uint64_t i = 0; i < count; i += svcntw()) {
+            const svbool_t pg = svwhilelt_b32_u64(i, count);
+            svst1_u32(pg, dst + i, svrevb_u32_x(pg, svld1_u32(pg, src + i)));
+        }
+    } else {
+        static_assert(W == 8, "SVE kernel supports 2, 4 and 8 byte elements");
+        const auto *src = reinterpret_cast<const std::uint64_t *>(s);
+        auto       *dst = reinterpret_cast<std::uint64_t *>(d);
+        for (std::uint64_t i = 0; i < count; i += svcntd()) {
+            const svbool_t pg = svwhilelt_b64_u64(i, count);
+            svst1_u64(pg, dst + i, svrevb_u64_x(pg, svld1_u64(pg, src + i)));
+        }
+    }
+}
+#endif
+
+/**
+ * @brief byte swap of n elements with W bytes each (unaligned loads and stores)
+ * @details Uses the widest vector unit that is available at compile time. The scalar path handles the tail.
+ * src and dst may be identical (in place conversion), but must not overlap otherwise. No alignment is required.
+ */
+template <std::size_t W>
+inline void swap_bytes_unaligned(const void *src, void *dst, std::size_t n) noexcept {
+    const auto *s = static_cast<const std::uint8_t *>(src);
+    auto       *d = static_cast<std::uint8_t *>(dst);
+
+    std::size_t       i     = 0;
+    const std::size_t bytes = n * W;
+
+#if defined(CXXENDIAN_HAVE_SVE)
+    if constexpr (W == 2 || W == 4 || W == 8) {
+        swap_bytes_sve<W>(s, d, n);
+        return;
+    }
+#endif
+
+    if constexpr (W == 2 || W == 4 || W == 8 || W == 16) {
+#if defined(CXXENDIAN_HAVE_AVX512)
+        for (; i + 64 <= bytes; i += 64) {
+            const __m512i v = _mm512_loadu_si512(s + i);
+            _mm512_storeu_si512(d + i, swap_vec<W>(v));
+        }
+#endif
+#if defined(CXXENDIAN_HAVE_AVX2)
+        for (; i + 32 <= bytes; i += 32) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(d + i), swap_vec<W>(v));
+        }
+#endif
+#if defined(CXXENDIAN_HAVE_SSE2)
+        for (; i + 16 <= bytes; i += 16) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(d + i), swap_vec<W>(v));
+        }
+#endif
+#if defined(CXXENDIAN_HAVE_VSX) || defined(CXXENDIAN_HAVE_ZVECTOR)
+        for (; i + 16 <= bytes; i += 16) {
+            const __vector unsigned char v = vec_xl(0, s + i);
+            vec_xst(swap_vec<W>(v), 0, d + i);
+        }
+#endif
+#if defined(CXXENDIAN_HAVE_NEON)
+        for (; i + 64 <= bytes; i += 64) {
+            const uint8x16_t v0 = vld1q_u8(s + i);
+            const uint8x16_t v1 = vld1q_u8(s + i + 16);
+            const uint8x16_t v2 = vld1q_u8(s + i + 32);
+            const uint8x16_t v3 = vld1q_u8(s + i + 48);
+            vst1q_u8(d + i, swap_vec<W>(v0));
+            vst1q_u8(d + i + 16, swap_vec<W>(v1));
+            vst1q_u8(d + i + 32, swap_vec<W>(v2));
+            vst1q_u8(d + i + 48, swap_vec<W>(v3));
+        }
+        for (; i + 16 <= bytes; i += 16)
+            vst1q_u8(d + i, swap_vec<W>(vld1q_u8(s + i)));
+#endif
+    }
+
+    swap_scalar<W>(s + i, d + i, (bytes - i) / W);
+}
+
+#if defined(CXXENDIAN_HAVE_AVX512)
+//* width of the widest vector unit in bytes
+constexpr std::size_t VECTOR_BYTES = 64;
+#elif defined(CXXENDIAN_HAVE_AVX2)
+constexpr std::size_t VECTOR_BYTES = 32;
+#elif defined(CXXENDIAN_HAVE_SSE2) || defined(CXXENDIAN_HAVE_VSX) || defined(CXXENDIAN_HAVE_ZVECTOR) ||             \
+        defined(CXXENDIAN_HAVE_NEON)
+constexpr std::size_t VECTOR_BYTES = 16;
+#else
+constexpr std::size_t VECTOR_BYTES = 0;
+#endif
+
+#if defined(CXXENDIAN_HAVE_SSE2)
+/**
+ * @brief vector body of the aligned kernels
+ * @details d must be aligned to VECTOR_BYTES, s only if ALIGNED_LOAD is set. Non-temporal stores are followed by a
+ * store fence unless FENCE is cleared (the caller fences once after several calls).
+ * @return number of processed bytes (multiple of VECTOR_BYTES)
+ */
+template <std::size_t W, bool ALIGNED_LOAD, bool STREAM, bool FENCE = STREAM>
+inline std::size_t swap_body(const std::uint8_t *s, std::uint8_t *d, std::size_t bytes) noexcept {
+    std::size_t i = 0;
+    for (; i + VECTOR_BYTES <= bytes; i += VECTOR_BYTES) {
+#    if defined(CXXENDIAN_HAVE_AVX512)
+        __m512i v;
+        if constexpr (ALIGNED_LOAD) v = _mm512_load_si512(s + i);
+        else v = _mm512_loadu_si512(s + i);
+        if constexpr (STREAM) _mm512_stream_si512(reinterpret_cast<__m512i *>(d + i), swap_vec<W>(v));
+        else _mm512_store_si512(d + i, swap_vec<W>(v));
+#    elif defined(CXXENDIAN_HAVE_AVX2)
+        __m256i v;
+        if constexpr (ALIGNED_LOAD) v = _mm256_load_si256(reinterpret_cast<const __m256i *>(s + i));
+        else v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i));
+        if constexpr (STREAM) _mm256_stream_si256(reinterpret_cast<__m256i *>(d + i), swap_vec<W>(v));
+        else _mm256_store_si256(reinterpret_cast<__m256i *>(d + i), swap_vec<W>(v));
+#    else
+        __m128i v;
+        if constexpr (ALIGNED_LOAD) v = _mm_load_si128(reinterpret_cast<const __m128i *>(s + i));
+        else v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+        if constexpr (STREAM) _mm_stream_si128(reinterpret_cast<__m128i *>(d + i), swap_vec<W>(v));
+        else _mm_store_si128(reinterpret_cast<__m128i *>(d + i), swap_vec<W>(v));
+#    endif
+    }
+    if constexpr (STREAM && FENCE) _mm_sfence();
+    return i;
+}
+#endif
+
+/**
+ * @brief byte swap of n elements with W bytes each that aligns the output to the vector width
+ * @details A scalar prologue handles the elements up to the first aligned output address. The vector body uses
+ * aligned stores (non-temporal if STREAM is set) and aligned loads if the input has the same alignment as the output.
+ * A scalar epilogue handles the tail. Falls back to swap_bytes_unaligned if the output can never be aligned
+ * (address not a multiple of W). If FENCE is cleared, the caller has to issue the store fence of the non-temporal
+ * stores.
+ */
+template <std::size_t W, bool STREAM, bool FENCE = STREAM>
+inline void swap_bytes_aligned(const void *src, void *dst, std::size_t n) noexcept {
+#if defined(CXXENDIAN_HAVE_SSE2)
+    if constexpr (W == 2 || W == 4 || W == 8 || W == 16) {
+        const auto *s = static_cast<const std::uint8_t *>(src);
+        auto       *d = static_cast<std::uint8_t *>(dst);
+
+        const std::size_t misalignment = reinterpret_cast<std::uintptr_t>(d) % VECTOR_BYTES;
+        if (misalignment % W == 0) {
+            // prologue
+            const std::size_t head = std::min(n, ((VECTOR_BYTES - misalignment) % VECTOR_BYTES) / W);
+            swap_scalar<W>(s, d, head);
+            s += head * W;
+            d += head * W;
+
+            // vector body
+            const std::size_t bytes = (n - head) * W;
+            const std::size_t done  = reinterpret_cast<std::uintptr_t>(s) % VECTOR_BYTES == 0
+                                              ? swap_body<W, true, STREAM, FENCE>(s, d, bytes)
+                                              : swap_body<W, false, STREAM, FENCE>(s, d, bytes);
+
+            // epilogue
+            swap_scalar<W>(s + done, d + done, (bytes - done) / W);
+            return;
+        }
+    }
+#endif
+    swap_bytes_unaligned<W>(src, dst, n);
+}
+
+/**
+ * @brief byte swap of n elements with W bytes each, src and dst are aligned to BULK_ALIGNMENT
+ */
+template <std::size_t W>
+inline void swap_bytes_assume_aligned(const void *src, void *dst, std::size_t n) noexcept {
+#if defined(CXXENDIAN_HAVE_SSE2)
+    if constexpr (W == 2 || W == 4 || W == 8 || W == 16) {
+        const auto       *s     = static_cast<const std::uint8_t *>(src);
+        auto             *d     = static_cast<std::uint8_t *>(dst);
+        const std::size_t bytes = n * W;
+        const std::size_t done  = swap_body<W, true, false>(s, d, bytes);
+        swap_scalar<W>(s + done, d + done, (bytes - done) / W);
+        return;
+    }
+#endif
+    swap_bytes_unaligned<W>(src, dst, n);
+}
+
+/**
+ * @brief byte swap of n elements with W bytes each
+ * @details
+ * Selects the kernel based on the size of the data:
+ *  - small arrays: unaligned vector kernel (no prologue)
+ *  - larger arrays: kernel with aligned output
+ *  - outputs of at least CXXENDIAN_STREAM_THRESHOLD bytes: non-temporal stores that bypass the cache
+ *
+ * src and dst may be identical (in place conversion), but must not overlap otherwise. No alignment is required.
+ */
+template <std::size_t W>
+inline void swap_bytes(const void *src, void *dst, std::size_t n) noexcept {
+    const std::size_t bytes = n * W;
+    if (bytes < 4 * VECTOR_BYTES) swap_bytes_unaligned<W>(src, dst, n);
+    else if (bytes >= CXXENDIAN_STREAM_THRESHOLD && src != dst) swap_bytes_aligned<W, true>(src, dst, n);
+    else swap_bytes_aligned<W, false>(src, dst, n);
+}
+
+/**
+ * @brief convert n elements with W bytes each between byte order order and host endian
+ * @details Shared implementation of to_host_n and from_host_n (both directions are the same operation).
+ */
+template <Order order, std::size_t W>
+inline void convert_bytes(const void *src, void *dst, std::size_t n) noexcept {
+    if constexpr (order == HostOrder) {
+        if (n && src != dst) std::memmove(dst, src, n * W);
+    } else {
+        swap_bytes<W>(src, dst, n);
+    }
+}
+
+constexpr instrument::Direction to_host_direction(Order order) noexcept {
+    return order == Order::Big ? instrument::Direction::Big_To_Host : instrument::Direction::Little_To_Host;
+}
+
+constexpr instrument::Direction from_host_direction(Order order) noexcept {
+    return order == Order::Big ? instrument::Direction::Host_To_Big : instrument::Direction::Host_To_Little;
+}
+
+}  // namespace detail
+
+//* alignment in bytes that is required by the assume_aligned overloads
+constexpr std::size_t BULK_ALIGNMENT = 64;
+
+/**
+ * @brief tag type: input and output of a bulk conversion are aligned to BULK_ALIGNMENT
+ */
+struct Assume_Aligned {};
+
+/**
+ * @brief tag type: write the output of a bulk conversion with non-temporal (streaming) stores
+ */
+struct Non_Temporal {};
+
+/**
+ * @brief tag: input and output of a bulk conversion are aligned to BULK_ALIGNMENT
+ * @details The conversion uses aligned loads and stores without prologue. Use for DMA buffers and other storage that
+ * is known to be aligned.
+ */
+constexpr Assume_Aligned assume_aligned {};
+
+/**
+ * @brief tag: write the output of a bulk conversion with non-temporal stores
+ * @details Use for large outputs that are not read again soon. The output does not evict the working set of the
+ * caller from the cache. Inputs and outputs may have any alignment.
+ */
+constexpr Non_Temporal non_temporal {};
+
+/**
+ * @brief swap endianness of an array
+ * @details bulk version of swap. src and dst may be identical (in place conversion), but must not overlap otherwise.
+ * @tparam T data type
+ * @param src input
+ * @param dst output
+ * @param n number of elements
+ */
+template <typename T>
+inline void swap_n(const T *src, T *dst, std::size_t n) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value, "swap_n requires a trivially copyable type");
+    CXXENDIAN_COUNT_BULK(instrument::Direction::Swap, sizeof(T), n);
+    detail::swap_bytes<sizeof(T)>(src, dst, n);
+}
+
+/**
+ * @brief swap endianness of an array (aligned input and output)
+ * @details see swap_n and assume_aligned
+ * @tparam T data type
+ * @param src input (aligned to BULK_ALIGNMENT)
+ * @param dst output (aligned to BULK_ALIGNMENT)
+ * @param n number of elements
+ */
+template <typename T>
+inline void swap_n(const T *src, T *dst, std::size_t n, Assume_Aligned) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value, "swap_n requires a trivially copyable type");
+    CXXENDIAN_COUNT_BULK(instrument::Direction::Swap, sizeof(T), n);
+    detail::swap_bytes_assume_aligned<sizeof(T)>(src, dst, n);
+}
+
+/**
+ * @brief swap endianness of an array (non-temporal stores)
+ * @details see swap_n and non_temporal
+ * @tparam T data type
+ * @param src input
+ * @param dst output
+ * @param n number of elements
+ */
+template <typename T>
+inline void swap_n(const T *src, T *dst, std::size_t n, Non_Temporal) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value, "swap_n requires a trivially copyable type");
+    CXXENDIAN_COUNT_BULK(instrument::Direction::Swap, sizeof(T), n);
+    detail::swap_bytes_aligned<sizeof(T), true>(src, dst, n);
+}
+
+/**
+ * @brief convert an array from the given byte order to host endian
+ * @details src does not need to be aligned for T. src and dst may be identical, but must not overlap otherwise.
+ * @tparam order byte order of src
+ * @tparam T data type
+ * @param src input (n elements of type T in byte order order)
+ * @param dst output
+ * @param n number of elements
+ */
+template <Order order, typename T>
+inline void to_host_n(const void *src, T *dst, std::size_t n) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value, "to_host_n requires a trivially copyable type");
+    CXXENDIAN_COUNT_BULK(detail::to_host_direction(order), sizeof(T), n);
+    detail::convert_bytes<order, sizeof(T)>(src, dst, n);
+}
+
+/**
+ * @brief convert an array from the given byte order to host endian (aligned input and output)
+ * @details see to_host_n and assume_aligned
+ * @tparam order byte order of src
+ * @tparam T data type
+ * @param src input (aligned to BULK_ALIGNMENT)
+ * @param dst output (aligned to BULK_ALIGNMENT)
+ * @param n number of elements
+ */
+template <Order order, typename T>
+inline void to_host_n(const void *src, T *dst, std::size_t n, Assume_Aligned) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value, "to_host_n requires a trivially copyable type");
+    CXXENDIAN_COUNT_BULK(detail::to_host_direction(order), sizeof(T), n);
+    if constexpr (order == HostOrder) {
+        if (n && src != dst) std::memmove(dst, src, n * sizeof(T));
+    } else {
+        detail::swap_bytes_assume_aligned<sizeof(T)>(src, dst, n);
+    }
+}
+
+/**
+ * @brief convert an array from the given byte order to host endian (non-temporal stores)
+ * @details see to_host_n and non_temporal
+ * @tparam order byte order of src
+ * @tparam T data type
+ * @param src input
+ * @param dst output
+ * @param n number of elements
+ */
+template <Order order, typename T>
+inline void to_host_n(const void *src, T *dst, std::size_t n, Non_Temporal) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value, "to_host_n requires a trivially copyable type");
+    CXXENDIAN_COUNT_BULK(detail::to_host_direction(order), sizeof(T), n);
+    if constexpr (order == HostOrder) {
+        if (n && src != dst) std::memmove(dst, src, n * sizeof(T));
+    } else {
+        detail::swap_bytes_aligned<sizeof(T), true>(src, dst, n);
+    }
+}
+
+/**
+ * @brief convert an array from host endian to the given byte order
+ * @details dst does not need to be aligned for T. src and dst may be identical, but must not overlap otherwise.
+ * @tparam order byte order of dst
+ * @tparam T data type
+ * @param src input
+ * @param dst output (n elements of type T in byte order order)
+ * @param n number of elements
+ */
+template <Order order, typename T>
+inline void from_host_n(const T *src, void *dst, std::size_t n) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value, "from_host_n requires a trivially copyable type");
+    CXXENDIAN_COUNT_BULK(detail::from_host_direction(order), sizeof(T), n);
+    detail::convert_bytes<order, sizeof(T)>(src, dst, n);
+}
+
+/**
+ * @brief convert an array from host endian to the given byte order (aligned input and output)
+ * @details see from_host_n and assume_aligned
+ * @tparam order byte order of dst
+ * @tparam T data type
+ * @param src input (aligned to BULK_ALIGNMENT)
+ * @param dst output (aligned to BULK_ALIGNMENT)
+ * @param n number of elements
+ */
+template <Order order, typename T>
+inline void from_host_n(const T *src, void *dst, std::size_t n, Assume_Aligned) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value, "from_host_n requires a trivially copyable type");
+    CXXENDIAN_COUNT_BULK(detail::from_host_direction(order), sizeof(T), n);
+    if constexpr (order == HostOrder) {
+        if (n && src != dst) std::memmove(dst, src, n * sizeof(T));
+    } else {
+        detail::swap_bytes_assume_aligned<sizeof(T)>(src, dst, n);
+    }
+}
+
+/**
+ * @brief convert an array from host endian to the given byte order (non-temporal stores)
+ * @details see from_host_n and non_temporal
+ * @tparam order byte order of dst
+ * @tparam T data type
+ * @param src input
+ * @param dst output
+ * @param n number of elements
+ */
+template <Order order, typename T>
+inline void from_host_n(const T *src, void *dst, std::size_t n, Non_Temporal) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value, "from_host_n requires a trivially copyable type");
+    CXXENDIAN_COUNT_BULK(detail::from_host_direction(order), sizeof(T), n);
+    if constexpr (order == HostOrder) {
+        if (n && src != dst) std::memmove(dst, src, n * sizeof(T));
+    } else {
+        detail::swap_bytes_aligned<sizeof(T), true>(src, dst, n);
+    }
+}
+
+/**
+ * @brief convert an array from big endian to host endian
+ * @details bulk version of big_to_host
+ * @tparam T data type
+ * @param src big endian input
+ * @param dst host endian output
+ * @param n number of elements
+ */
+template <typename T>
+inline void big_to_host_n(const void *src, T *dst, std::size_t n) noexcept {
+    to_host_n<Order::Big>(src, dst, n);
+}
+
+/**
+ * @brief convert an array from little endian to host endian
+ * @details bulk version of little_to_host
+ * @tparam T data type
+ * @param src little endian input
+ * @param dst host endian output
+ * @param n number of elements
+ */
+template <typename T>
+inline void little_to_host_n(const void *src, T *dst, std::size_t n) noexcept {
+    to_host_n<Order::Little>(src, dst, n);
+}
+
+/**
+ * @brief convert an array from host endian to big endian
+ * @details bulk version of host_to_big
+ * @tparam T data type
+ * @param src host endian input
+ * @param dst big endian output
+ * @param n number of elements
+ */
+template <typename T>
+inline void host_to_big_n(const T *src, void *dst, std::size_t n) noexcept {
+    from_host_n<Order::Big>(src, dst, n);
+}
+
+/**
+ * @brief convert an array from host endian to little endian
+ * @details bulk version of host_to_little
+ * @tparam T data type
+ * @param src host endian input
+ * @param dst little endian output
+ * @param n number of elements
+ */
+template <typename T>
+inline void host_to_little_n(const T *src, void *dst, std::size_t n) noexcept {
+    from_host_n<Order::Little>(src, dst, n);
+}
+
+}  // namespace endian
@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "strided.hpp"
+#include "traits.hpp"
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace cxxendian {
+
+/**
+ * @brief field of a wire format record
+ * @tparam Type endian type of the field (e.g. BE_Int<uint16_t>, LE_Float<double>)
+ * @tparam Offset byte offset of the field within the record
+ */
+template <typename Type, std::size_t Offset>
+struct Field {
+    //* endian type of the field
+    using type = Type;
+    //* base data type of the field (type of the host endian column)
+    using value_type = typename Endian_Traits<Type>::value_type;
+    //* byte order of the field
+    static constexpr endian::Order order = Endian_Traits<Type>::order;
+    //* byte offset of the field within the record
+    static constexpr std::size_t offset = Offset;
+    //* size of the field in bytes
+    static constexpr std::size_t size = sizeof(value_type);
+};
+
+/**
+ * @brief decoder/encoder for arrays of wire format records (array of structs <--> one host endian column per field)
+ * @details
+ * The records are processed in blocks that fit into the L1 cache. All fields of a block are extracted before the
+ * next block is loaded (blocked transposition). The input is therefore read from memory only once and every column is
+ * written sequentially.
+ *
+ * Example:
+ * @code
+ * using Sample = cxxendian::Record_Codec<cxxendian::Field<cxxendian::BE_Int<uint32_t>, 0>,
+ *                                        cxxendian::Field<cxxendian::BE_Int<uint16_t>, 4>,
+ *                                        cxxendian::Field<cxxendian::LE_Float<double>, 8>>;
+ * Sample::decode(rx_buffer, n, timestamps, channels, values);
+ * @endcode
+ *
+ * @tparam Fields record fields (Field<Type, Offset>)
+ */
+template <typename... Fields>
+class Record_Codec {
+    static_assert(sizeof...(Fields) > 0, "a record needs at least one field");
+
+    static constexpr bool fields_disjoint() {
+        constexpr std::size_t offsets[] = {Fields::offset...};
+        constexpr std::size_t sizes[]   = {Fields::size...};
+        for (std::size_t i = 0; i < sizeof...(Fields); ++i)
+            for (std::size_t j = i + 1; j < sizeof...(Fields); ++j)
+                if (offsets[i] < offsets[j] + sizes[j] && offsets[j] < offsets[i] + sizes[i]) return false;
+        return true;
+    }
+
+    static_assert(fields_disjoint(), "record fields must not overlap");
+
+    //* bytes of wire data per block (half of a typical 32 KiB L1 data cache)
+    static constexpr std::size_t BLOCK_BYTES = 16 * 1024;
+
+    static std::size_t block_records(std::size_t stride) noexcept {
+        return std::max<std::size_t>(1, BLOCK_BYTES / std::max<std::size_t>(1, stride));
+    }
+
+    static void count_bulk([[maybe_unused]] endian::instrument::Direction direction,
+                           [[maybe_unused]] std::size_t                   width,
+                           [[maybe_unused]] std::size_t                   n) noexcept {
+        CXXENDIAN_COUNT_BULK(direction, width, n);
+    }
+
+public:
+    //* size of a record without trailing padding (end of the last field)
+    static constexpr std::size_t size = std::max({(Fields::offset + Fields::size)...});
+
+    //* byte offsets of the fields within the record (same order as Fields)
+    static constexpr std::size_t offsets[sizeof...(Fields)] = {Fields::offset...};
+
+    //* count the decoding of n records as one bulk conversion per field (for internal use only)
+    static void count_decode(std::size_t n) noexcept {
+        (count_bulk(endian::detail::to_host_direction(Fields::order), Fields::size, n), ...);
+    }
+
+    //* count the encoding of n records as one bulk conversion per field (for internal use only)
+    static void count_encode(std::size_t n) noexcept {
+        (count_bulk(endian::detail::from_host_direction(Fields::order), Fields::size, n), ...);
+    }
+
+    /**
+     * @brief decode records that are stored with a distance of stride bytes (for internal use only)
+     * @details Same as decode_strided, but not counted by the instrumentation (for callers that count themselves).
+     * @param records first record (no alignment required)
+     * @param stride distance between two records in bytes (>= size)
+     * @param n number of records
+     * @param columns one output array with n elements per field (same order as Fields)
+     */
+    static void decode_blocks(const void  *records,
+                              std::size_t  stride,
+                              std::size_t  n,
+                              typename Fields::value_type *...columns) noexcept {
+        const auto       *src   = static_cast<const std::uint8_t *>(records);
+        const std::size_t block = block_records(stride);
+
+        for (std::size_t i = 0; i < n; i += block) {
+            const std::size_t m = std::min(block, n - i);
+            const auto       *b = src + i * stride;
+            (endian::detail::gather_strided<Fields::size, Fields::order != endian::HostOrder>(
+                     b + Fields::offset, stride, reinterpret_cast<std::uint8_t *>(columns + i), m),
+             ...);
+        }
+    }
+
+    /**
+     * @brief decode records that are stored with a distance of stride bytes
+     * @param records first record (no alignment required)
+     * @param stride distance between two records in bytes (>= size)
+     * @param n number of records
+     * @param columns one output array with n elements per field (same order as Fields)
+     */
+    static void decode_strided(const void  *records,
+                               std::size_t  stride,
+                               std::size_t  n,
+                               typename Fields::value_type *...columns) noexcept {
+        count_decode(n);
+        decode_blocks(records, stride, n, columns...);
+    }
+
+    /**
+     * @brief decode densely packed records (stride == size)
+     * @param records first record (no alignment required)
+     * @param n number of records
+     * @param columns one output array with n elements per field (same order as Fields)
+     */
+    static void decode(const void *records, std::size_t n, typename Fields::value_type *...columns) noexcept {
+        decode_strided(records, size, n, columns...);
+    }
+
+    /**
+     * @brief encode records that are stored with a distance of stride bytes
+     * @details Bytes that do not belong to a field are not modified.
+     * @param records first record (no alignment required)
+     * @param stride distance between two records in bytes (>= size)
+     * @param n number of records
+     * @param columns one input array with n elements per field (same order as Fields)
+     */
+    static void encode_strided(void        *records,
+                               std::size_t  stride,
+                               std::size_t  n,
+                               const typename Fields::value_type *...columns) noexcept {
+        count_encode(n);
+        auto             *dst   = static_cast<std::uint8_t *>(records);
+        const std::size_t block = block_records(stride);
+
+        for (std::size_t i = 0; i < n; i += block) {
+            const std::size_t m = std::min(block, n - i);
+            auto             *b = dst + i * stride;
+            (endian::detail::scatter_strided<Fields::size, Fields::order != endian::HostOrder>(
+                     reinterpret_cast<const std::uint8_t *>(columns + i), b + Fields::offset, stride, m),
+             ...);
+        }
+    }
+
+    /**
+     * @brief encode densely packed records (stride == size)
+     * @details Bytes that do not belong to a field are not modified.
+     * @param records first record (no alignment required)
+     * @param n number of records
+     * @param columns one input array with n elements per field (same order as Fields)
+     */
+    static void encode(void *records, std::size_t n, const typename Fields::value_type *...columns) noexcept {
+        encode_strided(records, size, n, columns...);
+    }
+};
+
+}  // namespace cxxendian
@@ -0,0 +1,386 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "bulk.hpp"
+#include "vec_ops.hpp"
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace endian {
+
+/**
+ * @brief transformation of the values of a block before bit packing
+ */
+enum class Pack_Mode {
+    For,   //* frame of reference: values minus the minimum of the block
+    Delta  //* differences of consecutive values (signed) minus the minimum difference of the block
+};
+
+//* number of values per block of the packed format
+constexpr std::size_t PACK_BLOCK = 128;
+
+/**
+ * @brief maximum size of n packed values
+ * @tparam T data type
+ * @param n number of values
+ * @return size in bytes
+ */
+template <typename T>
+constexpr std::size_t max_packed_size(std::size_t n) noexcept {
+    return sizeof(T) + (n + PACK_BLOCK - 1) / PACK_BLOCK * (sizeof(T) + 1) + n * sizeof(T);
+}
+
+namespace detail {
+
+template <typename T>
+constexpr void check_pack_type() noexcept {
+    static_assert(std::is_integral<T>::value, "packing requires an integer type");
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+                  "packing requires a 1, 2, 4 or 8 byte integer type");
+}
+
+//* number of values that are converted per block by the fused delta functions (stack buffer, stays in L1)
+constexpr std::size_t DELTA_BLOCK = 256;
+
+/**
+ * @brief number of bits that are required to store v
+ */
+inline unsigned bit_width(std::uint64_t v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return v ? 64u - static_cast<unsigned>(__builtin_clzll(v)) : 0u;
+#else
+    unsigned n = 0;
+    for (; v; v >>= 1)
+        ++n;
+    return n;
+#endif
+}
+
+#if defined(CXXENDIAN_HAVE_SSE2)
+template <std::size_t W>
+inline __m128i add_lanes(__m128i a, __m128i b) noexcept {
+    if constexpr (W == 1) return _mm_add_epi8(a, b);
+    else if constexpr (W == 2) return _mm_add_epi16(a, b);
+    else if constexpr (W == 4) return _mm_add_epi32(a, b);
+    else return _mm_add_epi64(a, b);
+}
+
+// last lane of v in all lanes
+template <std::size_t W>
+inline __m128i broadcast_last(__m128i v) noexcept {
+    if constexpr (W == 1) return _mm_set1_epi8(static_cast<char>(_mm_extract_epi16(v, 7) >> 8));
+    else if constexpr (W == 2) return _mm_set1_epi16(static_cast<short>(_mm_extract_epi16(v, 7)));
+    else if constexpr (W == 4) return _mm_shuffle_epi32(v, 0xFF);
+    else return _mm_shuffle_epi32(v, 0xEE);
+}
+#endif
+
+/**
+ * @brief inclusive prefix sum (modulo 2^bits) in place
+ * @details SSE2: log2(lanes) shifted additions per vector, the carry is broadcast from the last lane.
+ * @param v values
+ * @param n number of values
+ * @param carry value that is added to all values (sum of the previous values)
+ * @return sum of all values (carry for the next call)
+ */
+template <typename U>
+inline U prefix_sum(U *v, std::size_t n, U carry) noexcept {
+    std::size_t i = 0;
+#if defined(CXXENDIAN_HAVE_SSE2)
+    constexpr std::size_t W = sizeof(U);
+    constexpr std::size_t L = 16 / W;
+    if (n >= L) {
+        U c_lanes[L];
+        std::fill(c_lanes, c_lanes + L, carry);
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(c_lanes));
+        for (; i + L <= n; i += L) {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(v + i));
+            x         = add_lanes<W>(x, _mm_slli_si128(x, W));
+            if constexpr (W <= 4) x = add_lanes<W>(x, _mm_slli_si128(x, 2 * W));
+            if constexpr (W <= 2) x = add_lanes<W>(x, _mm_slli_si128(x, 4 * W));
+            if constexpr (W == 1) x = add_lanes<W>(x, _mm_slli_si128(x, 8));
+            x = add_lanes<W>(x, c);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(v + i), x);
+            c = broadcast_last<W>(x);
+        }
+        carry = v[i - 1];
+    }
+#endif
+    for (; i < n; ++i)
+        v[i] = carry = static_cast<U>(carry + v[i]);
+    return carry;
+}
+
+/**
+ * @brief pack the offsets of one block (transformed host values) into a little endian bit stream
+ * @param v values (at most PACK_BLOCK, modified: offsets to the reference)
+ * @param m number of values
+ * @param bias sign bit to compare the values as signed values, 0 to compare them as unsigned values
+ * @param dst output
+ * @return number of bytes written
+ */
+template <typename U>
+inline std::size_t pack_block(U *v, std::size_t m, U bias, std::uint8_t *dst) noexcept {
+    U lo = static_cast<U>(v[0] ^ bias), hi = lo;
+    for (std::size_t i = 1; i < m; ++i) {
+        const U b = static_cast<U>(v[i] ^ bias);
+        lo        = std::min(lo, b);
+        hi        = std::max(hi, b);
+    }
+    const U        ref  = static_cast<U>(lo ^ bias);
+    const unsigned bits = bit_width(static_cast<std::uint64_t>(hi - lo));
+
+    store<Order::Little>(dst, ref);
+    dst[sizeof(U)] = static_cast<std::uint8_t>(bits);
+    dst += sizeof(U) + 1;
+
+    const std::size_t bytes = (m * bits + 7) / 8;
+    if (bits == 0) return sizeof(U) + 1;
+
+    // 64 bit accumulator, written as a whole word when full
+    std::uint8_t  buf[PACK_BLOCK * 8 + 8];
+    std::uint8_t *out  = buf;
+    std::uint64_t acc  = 0;
+    unsigned      fill = 0;
+    for (std::size_t i = 0; i < m; ++i) {
+        const std::uint64_t off = static_cast<U>(v[i] - ref);
+        acc |= off << fill;
+        fill += bits;
+        if (fill >= 64) {
+            store<Order::Little>(out, acc);
+            out += 8;
+            fill -= 64;
+            acc = fill ? off >> (bits - fill) : 0;
+        }
+    }
+    store<Order::Little>(out, acc);
+    std::memcpy(dst, buf, bytes);
+    return sizeof(U) + 1 + bytes;
+}
+
+/**
+ * @brief unpack one block
+ * @param src input (block header and bit stream)
+ * @param size available input bytes
+ * @param m number of values of the block
+ * @param v output (host values before the inverse transformation)
+ * @return number of bytes read, 0 if the input is truncated or invalid
+ */
+template <typename U>
+inline std::size_t unpack_block(const std::uint8_t *src, std::size_t size, std::size_t m, U *v) noexcept {
+    if (size < sizeof(U) + 1) return 0;
+    const U        ref  = load<Order::Little, U>(src);
+    const unsigned bits = src[sizeof(U)];
+    if (bits > 8 * sizeof(U)) return 0;
+    const std::size_t bytes = (m * bits + 7) / 8;
+    if (size - (sizeof(U) + 1) < bytes) return 0;
+
+    if (bits == 0) {
+        std::fill(v, v + m, ref);
+        return sizeof(U) + 1;
+    }
+
+    std::uint8_t buf[PACK_BLOCK * 8 + 16];
+    std::memcpy(buf, src + sizeof(U) + 1, bytes);
+    std::memset(buf + bytes, 0, 16);
+    const std::uint64_t mask = bits == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << bits) - 1;
+    if (bits <= 57) {
+        // every value is within the 64 bit word at its first byte
+        for (std::size_t i = 0; i < m; ++i) {
+            const std::size_t pos = i * bits;
+            const std::uint64_t w = load<Order::Little, std::uint64_t>(buf + pos / 8) >> (pos & 7u);
+            v[i]                  = static_cast<U>(ref + static_cast<U>(w & mask));
+        }
+        return sizeof(U) + 1 + bytes;
+    }
+    for (std::size_t i = 0; i < m; ++i) {
+        const std::size_t   pos   = i * bits;
+        const unsigned      shift = pos & 7u;
+        const std::uint8_t *p     = buf + pos / 8;
+        std::uint64_t       w     = load<Order::Little, std::uint64_t>(p) >> shift;
+        if (shift + bits > 64) w |= std::uint64_t(p[8]) << (64 - shift);
+        v[i] = static_cast<U>(ref + static_cast<U>(w & mask));
+    }
+    return sizeof(U) + 1 + bytes;
+}
+
+}  // namespace detail
+
+/**
+ * @brief convert an array to host endian and compute the differences of consecutive values (one pass)
+ * @details
+ * dst[0] = src[0], dst[i] = src[i] - src[i - 1] (modulo 2^bits). Monotonic sequences (timestamps, counters) result in
+ * small differences.
+ * @tparam order byte order of src
+ * @tparam T integer type
+ * @param src input (n elements of type T in byte order order, no alignment required)
+ * @param dst differences in host byte order
+ * @param n number of elements
+ */
+template <Order order, typename T>
+inline void delta_encode_n(const void *src, std::make_unsigned_t<T> *dst, std::size_t n) noexcept {
+    detail::check_pack_type<T>();
+    using U = std::make_unsigned_t<T>;
+
+    const auto *s    = static_cast<const std::uint8_t *>(src);
+    U           prev = 0;
+    U           buf[detail::DELTA_BLOCK];
+    for (std::size_t i = 0; i < n; i += detail::DELTA_BLOCK) {
+        const std::size_t m = std::min(detail::DELTA_BLOCK, n - i);
+        to_host_n<order>(s + i * sizeof(T), buf, m);
+        dst[i] = static_cast<U>(buf[0] - prev);
+        for (std::size_t j = 1; j < m; ++j)
+            dst[i + j] = static_cast<U>(buf[j] - buf[j - 1]);
+        prev = buf[m - 1];
+    }
+}
+
+/**
+ * @brief restore values from their differences and convert them to the given byte order (one pass)
+ * @details inverse of delta_encode_n (SIMD prefix sum)
+ * @tparam order byte order of dst
+ * @tparam T integer type
+ * @param src differences in host byte order
+ * @param dst output (n elements of type T in byte order order, no alignment required)
+ * @param n number of elements
+ */
+template <Order order, typename T>
+inline void delta_decode_n(const std::make_unsigned_t<T> *src, void *dst, std::size_t n) noexcept {
+    detail::check_pack_type<T>();
+    using U = std::make_unsigned_t<T>;
+
+    auto *d     = static_cast<std::uint8_t *>(dst);
+    U     carry = 0;
+    U     buf[detail::DELTA_BLOCK];
+    for (std::size_t i = 0; i < n; i += detail::DELTA_BLOCK) {
+        const std::size_t m = std::min(detail::DELTA_BLOCK, n - i);
+        std::copy(src + i, src + i + m, buf);
+        carry = detail::prefix_sum(buf, m, carry);
+        from_host_n<order>(buf, d + i * sizeof(T), m);
+    }
+}
+
+/**
+ * @brief convert an integer array to host endian and compress it (one pass)
+ * @details
+ * The values are processed in blocks of PACK_BLOCK values that stay in the L1 cache. Every block is converted to host
+ * endian, transformed (see Pack_Mode) and bit packed with the minimum number of bits of the block.
+ *
+ * Format (independent of the host): per block the reference (sizeof(T) bytes, little endian), the number of bits b
+ * (1 byte) and ceil(values * b / 8) bytes little endian bit stream. With Pack_Mode::Delta, the first value is stored
+ * as it is (sizeof(T) bytes, little endian, only if n > 0) and the blocks contain the n - 1 differences to the
+ * respective previous value.
+ *
+ * Example:
+ * @code
+ * std::vector<uint8_t> archive(endian::max_packed_size<uint64_t>(n));
+ * archive.resize(endian::pack_n<endian::Order::Big, uint64_t>(timestamps_be, n, archive.data(),
+ *                                                             endian::Pack_Mode::Delta));
+ * @endcode
+ *
+ * @tparam order byte order of src
+ * @tparam T integer type
+ * @param src input (n elements of type T in byte order order, no alignment required)
+ * @param n number of elements
+ * @param dst output (at least max_packed_size<T>(n) bytes)
+ * @param mode transformation before bit packing
+ * @return number of bytes written
+ */
+template <Order order, typename T>
+inline std::size_t pack_n(const void *src, std::size_t n, void *dst, Pack_Mode mode) noexcept {
+    detail::check_pack_type<T>();
+    using U = std::make_unsigned_t<T>;
+
+    // signed values and differences: minimum and maximum as signed values (small negative differences stay small)
+    constexpr U SIGN     = static_cast<U>(U(1) << (8 * sizeof(T) - 1));
+    constexpr U FOR_BIAS = std::is_signed<T>::value ? SIGN : U(0);
+
+    const auto *s    = static_cast<const std::uint8_t *>(src);
+    auto       *d    = static_cast<std::uint8_t *>(dst);
+    U           prev = 0;
+    U           buf[PACK_BLOCK];
+    if (mode == Pack_Mode::Delta && n > 0) {
+        // large first value (e.g. epoch timestamp) is stored once instead of widening the first block
+        prev = detail::load<order, U>(s);
+        detail::store<Order::Little>(d, prev);
+        d += sizeof(U);
+        s += sizeof(T);
+        --n;
+    }
+    for (std::size_t i = 0; i < n; i += PACK_BLOCK) {
+        const std::size_t m = std::min(PACK_BLOCK, n - i);
+        to_host_n<order>(s + i * sizeof(T), buf, m);
+        if (mode == Pack_Mode::Delta) {
+            const U last = buf[m - 1];
+            for (std::size_t j = m - 1; j > 0; --j)
+                buf[j] = static_cast<U>(buf[j] - buf[j - 1]);
+            buf[0] = static_cast<U>(buf[0] - prev);
+            prev   = last;
+            d += detail::pack_block(buf, m, SIGN, d);
+        } else {
+            d += detail::pack_block(buf, m, FOR_BIAS, d);
+        }
+    }
+    return static_cast<std::size_t>(d - static_cast<std::uint8_t *>(dst));
+}
+
+/**
+ * @brief decompress an integer array and convert it to the given byte order (one pass)
+ * @details inverse of pack_n. The byte order of the output is independent of the byte order that was packed.
+ * @tparam order byte order of dst
+ * @tparam T integer type (same as for pack_n)
+ * @param src input (output of pack_n)
+ * @param size size of the input in bytes
+ * @param dst output (n elements of type T in byte order order, no alignment required)
+ * @param n number of elements (same as for pack_n, 0 is a valid empty stream of 0 bytes)
+ * @param mode transformation (same as for pack_n)
+ * @param consumed number of bytes read from src (set on success only)
+ * @return true on success, false if the input is truncated or invalid (dst is partially written)
+ */
+template <Order order, typename T>
+inline bool unpack_n(const void  *src,
+                     std::size_t  size,
+                     void        *dst,
+                     std::size_t  n,
+                     Pack_Mode    mode,
+                     std::size_t &consumed) noexcept {
+    detail::check_pack_type<T>();
+    using U = std::make_unsigned_t<T>;
+
+    const auto *s     = static_cast<const std::uint8_t *>(src);
+    auto       *d     = static_cast<std::uint8_t *>(dst);
+    std::size_t pos   = 0;
+    U           carry = 0;
+    U           buf[PACK_BLOCK];
+    if (mode == Pack_Mode::Delta && n > 0) {
+        if (size < sizeof(U)) return false;
+        carry = detail::load<Order::Little, U>(s);
+        pos   = sizeof(U);
+        from_host_n<order>(&carry, d, 1);
+        d += sizeof(T);
+        --n;
+    }
+    for (std::size_t i = 0; i < n; i += PACK_BLOCK) {
+        const std::size_t m     = std::min(PACK_BLOCK, n - i);
+        const std::size_t bytes = detail::unpack_block(s + pos, size - pos, m, buf);
+        if (bytes == 0) return false;
+        pos += bytes;
+        if (mode == Pack_Mode::Delta) carry = detail::prefix_sum(buf, m, carry);
+        from_host_n<order>(buf, d + i * sizeof(T), m);
+    }
+    consumed = pos;
+    return true;
+}
+
+}  // namespace endian
@@ -0,0 +1,279 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "bulk.hpp"
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace endian {
+
+namespace detail {
+
+/**
+ * @brief number of elements that are converted per block
+ * @details The byte swapped block is kept in a stack buffer (at most 2 KiB) that stays in the L1 cache. The numeric
+ * conversion reads from this buffer. Input and output are therefore only touched once.
+ */
+constexpr std::size_t CONVERT_BLOCK = 256;
+
+/**
+ * @brief numeric conversion with saturation
+ * @details
+ *  - floating point to integer: round to nearest (current rounding mode), clamp to the range of To, NaN becomes 0
+ *  - integer to integer: clamp to the range of To
+ *  - to floating point: static_cast
+ * @tparam To target type
+ * @tparam From source type
+ * @param v value
+ * @return converted value
+ */
+template <typename To, typename From>
+inline To saturate_cast(From v) noexcept {
+    if constexpr (std::is_floating_point<To>::value) {
+        return static_cast<To>(v);
+    } else if constexpr (std::is_floating_point<From>::value) {
+        constexpr From lo = static_cast<From>(std::numeric_limits<To>::min());
+        // rounds up to the next power of two if max is not representable
+        constexpr From hi = static_cast<From>(std::numeric_limits<To>::max());
+
+        const From r = std::nearbyint(v);
+        return r >= hi  ? std::numeric_limits<To>::max()
+               : r > lo ? static_cast<To>(r)
+               : r <= lo ? std::numeric_limits<To>::min()
+                         : To(0);  // NaN
+    } else {
+        if constexpr (std::is_signed<From>::value) {
+            if (v < 0) {
+                if constexpr (std::is_signed<To>::value) {
+                    return static_cast<std::intmax_t>(v) < static_cast<std::intmax_t>(std::numeric_limits<To>::min())
+                                   ? std::numeric_limits<To>::min()
+                                   : static_cast<To>(v);
+                } else {
+                    return To(0);
+                }
+            }
+        }
+        return static_cast<std::uintmax_t>(v) > static_cast<std::uintmax_t>(std::numeric_limits<To>::max())
+                       ? std::numeric_limits<To>::max()
+                       : static_cast<To>(v);
+    }
+}
+
+}  // namespace detail
+
+/**
+ * @brief convert an array from the given byte order to host endian and change the data type
+ * @details Byte swap and numeric conversion (static_cast) are done in one pass over the data.
+ * @tparam order byte order of src
+ * @tparam Wire data type of the input elements
+ * @tparam To data type of the output elements
+ * @param src input (n elements of type Wire in byte order order, no alignment required)
+ * @param dst output
+ * @param n number of elements
+ */
+template <Order order, typename Wire, typename To>
+inline void to_host_convert_n(const void *src, To *dst, std::size_t n) noexcept {
+    static_assert(std::is_arithmetic<Wire>::value && std::is_arithmetic<To>::value, "arithmetic types required");
+    CXXENDIAN_COUNT_BULK(detail::to_host_direction(order), sizeof(Wire), n);
+
+    if constexpr (std::is_same<Wire, To>::value) {
+        detail::convert_bytes<order, sizeof(To)>(src, dst, n);
+    } else {
+        const auto *s = static_cast<const std::uint8_t *>(src);
+
+        alignas(64) Wire tmp[detail::CONVERT_BLOCK];
+        for (std::size_t i = 0; i < n; i += detail::CONVERT_BLOCK) {
+            const std::size_t m = std::min(detail::CONVERT_BLOCK, n - i);
+            detail::convert_bytes<order, sizeof(Wire)>(s + i * sizeof(Wire), tmp, m);
+            for (std::size_t j = 0; j < m; ++j)
+                dst[i + j] = static_cast<To>(tmp[j]);
+        }
+    }
+}
+
+/**
+ * @brief convert an array from the given byte order to host endian floating point values with scale and offset
+ * @details Byte swap, numeric conversion and dst = value * gain + offset are done in one pass over the data.
+ *
+ * Example: convert big endian 16 bit ADC samples to volts
+ * @code
+ * endian::to_host_convert_n<endian::Order::Big, int16_t>(rx_buffer, volts, n, 10.f / 32768.f, 0.f);
+ * @endcode
+ *
+ * @tparam order byte order of src
+ * @tparam Wire data type of the input elements
+ * @tparam To data type of the output elements (floating point only)
+ * @param src input (n elements of type Wire in byte order order, no alignment required)
+ * @param dst output
+ * @param n number of elements
+ * @param gain scale factor
+ * @param offset offset that is added after scaling
+ */
+template <Order order,
+          typename Wire,
+          typename To,
+          typename = typename std::enable_if_t<std::is_floating_point<To>::value>>
+inline void to_host_convert_n(const void *src, To *dst, std::size_t n, To gain, To offset) noexcept {
+    static_assert(std::is_arithmetic<Wire>::value, "arithmetic type required");
+    CXXENDIAN_COUNT_BULK(detail::to_host_direction(order), sizeof(Wire), n);
+
+    const auto *s = static_cast<const std::uint8_t *>(src);
+
+    alignas(64) Wire tmp[detail::CONVERT_BLOCK];
+    for (std::size_t i = 0; i < n; i += detail::CONVERT_BLOCK) {
+        const std::size_t m = std::min(detail::CONVERT_BLOCK, n - i);
+        detail::convert_bytes<order, sizeof(Wire)>(s + i * sizeof(Wire), tmp, m);
+        for (std::size_t j = 0; j < m; ++j)
+            dst[i + j] = static_cast<To>(tmp[j]) * gain + offset;
+    }
+}
+
+/**
+ * @brief convert an array from host endian to the given byte order and change the data type
+ * @details Numeric conversion and byte swap are done in one pass over the data.
+ * Values that are out of the range of Wire are saturated, floating point values are rounded to nearest and NaN is
+ * converted to 0 if Wire is an integer type.
+ * @tparam order byte order of dst
+ * @tparam Wire data type of the output elements
+ * @tparam From data type of the input elements
+ * @param src input
+ * @param dst output (n elements of type Wire in byte order order, no alignment required)
+ * @param n number of elements
+ */
+template <Order order, typename Wire, typename From>
+inline void from_host_convert_n(const From *src, void *dst, std::size_t n) noexcept {
+    static_assert(std::is_arithmetic<Wire>::value && std::is_arithmetic<From>::value, "arithmetic types required");
+    CXXENDIAN_COUNT_BULK(detail::from_host_direction(order), sizeof(Wire), n);
+
+    if constexpr (std::is_same<Wire, From>::value) {
+        detail::convert_bytes<order, sizeof(From)>(src, dst, n);
+    } else {
+        auto *d = static_cast<std::uint8_t *>(dst);
+
+        alignas(64) Wire tmp[detail::CONVERT_BLOCK];
+        for (std::size_t i = 0; i < n; i += detail::CONVERT_BLOCK) {
+            const std::size_t m = std::min(detail::CONVERT_BLOCK, n - i);
+            for (std::size_t j = 0; j < m; ++j)
+                tmp[j] = detail::saturate_cast<Wire>(src[i + j]);
+            detail::convert_bytes<order, sizeof(Wire)>(tmp, d + i * sizeof(Wire), m);
+        }
+    }
+}
+
+/**
+ * @brief convert an array of host endian floating point values to the given byte order with scale and offset
+ * @details Computes value * gain + offset and converts the result to Wire with saturation (see from_host_convert_n).
+ * All steps are done in one pass over the data.
+ * @tparam order byte order of dst
+ * @tparam Wire data type of the output elements
+ * @tparam From data type of the input elements (floating point only)
+ * @param src input
+ * @param dst output (n elements of type Wire in byte order order, no alignment required)
+ * @param n number of elements
+ * @param gain scale factor
+ * @param offset offset that is added after scaling
+ */
+template <Order order,
+          typename Wire,
+          typename From,
+          typename = typename std::enable_if_t<std::is_floating_point<From>::value>>
+inline void from_host_convert_n(const From *src, void *dst, std::size_t n, From gain, From offset) noexcept {
+    static_assert(std::is_arithmetic<Wire>::value, "arithmetic type required");
+    CXXENDIAN_COUNT_BULK(detail::from_host_direction(order), sizeof(Wire), n);
+
+    auto *d = static_cast<std::uint8_t *>(dst);
+
+    alignas(64) Wire tmp[detail::CONVERT_BLOCK];
+    for (std::size_t i = 0; i < n; i += detail::CONVERT_BLOCK) {
+        const std::size_t m = std::min(detail::CONVERT_BLOCK, n - i);
+        for (std::size_t j = 0; j < m; ++j)
+            tmp[j] = detail::saturate_cast<Wire>(src[i + j] * gain + offset);
+        detail::convert_bytes<order, sizeof(Wire)>(tmp, d + i * sizeof(Wire), m);
+    }
+}
+
+/**
+ * @brief convert an array from big endian to host endian and change the data type
+ * @details see to_host_convert_n
+ */
+template <typename Wire, typename To>
+inline void big_to_host_convert_n(const void *src, To *dst, std::size_t n) noexcept {
+    to_host_convert_n<Order::Big, Wire>(src, dst, n);
+}
+
+/**
+ * @brief convert an array from big endian to host endian floating point values with scale and offset
+ * @details see to_host_convert_n
+ */
+template <typename Wire, typename To>
+inline void big_to_host_convert_n(const void *src, To *dst, std::size_t n, To gain, To offset) noexcept {
+    to_host_convert_n<Order::Big, Wire>(src, dst, n, gain, offset);
+}
+
+/**
+ * @brief convert an array from little endian to host endian and change the data type
+ * @details see to_host_convert_n
+ */
+template <typename Wire, typename To>
+inline void little_to_host_convert_n(const void *src, To *dst, std::size_t n) noexcept {
+    to_host_convert_n<Order::Little, Wire>(src, dst, n);
+}
+
+/**
+ * @brief convert an array from little endian to host endian floating point values with scale and offset
+ * @details see to_host_convert_n
+ */
+template <typename Wire, typename To>
+inline void little_to_host_convert_n(const void *src, To *dst, std::size_t n, To gain, To offset) noexcept {
+    to_host_convert_n<Order::Little, Wire>(src, dst, n, gain, offset);
+}
+
+/**
+ * @brief convert an array from host endian to big endian and change the data type (saturating)
+ * @details see from_host_convert_n
+ */
+template <typename Wire, typename From>
+inline void host_to_big_convert_n(const From *src, void *dst, std::size_t n) noexcept {
+    from_host_convert_n<Order::Big, Wire>(src, dst, n);
+}
+
+/**
+ * @brief convert an array of host endian floating point values to big endian with scale and offset (saturating)
+ * @details see from_host_convert_n
+ */
+template <typename Wire, typename From>
+inline void host_to_big_convert_n(const From *src, void *dst, std::size_t n, From gain, From offset) noexcept {
+    from_host_convert_n<Order::Big, Wire>(src, dst, n, gain, offset);
+}
+
+/**
+ * @brief convert an array from host endian to little endian and change the data type (saturating)
+ * @details see from_host_convert_n
+ */
+template <typename Wire, typename From>
+inline void host_to_little_convert_n(const From *src, void *dst, std::size_t n) noexcept {
+    from_host_convert_n<Order::Little, Wire>(src, dst, n);
+}
+
+/**
+ * @brief convert an array of host endian floating point values to little endian with scale and offset (saturating)
+ * @details see from_host_convert_n
+ */
+template <typename Wire, typename From>
+inline void host_to_little_convert_n(const From *src, void *dst, std::size_t n, From gain, From offset) noexcept {
+    from_host_convert_n<Order::Little, Wire>(src, dst, n, gain, offset);
+}
+
+}  // namespace endian
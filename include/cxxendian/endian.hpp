@@ -19,6 +19,14 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#    include <cstdlib>
+#endif
+
+#include "instrument.hpp"
 
 static_assert(sizeof(uint8_t) == 1);
 
@@ -44,8 +52,151 @@ public:
     [[maybe_unused, nodiscard]] constexpr bool isLittle() const { return e.c[0] != 0; }
 } HostEndianness;
 
+/**
+ * @brief byte order of a value or buffer
+ */
+enum class Order { Little, Big };
+
+/**
+ * @brief byte order of the host as compile time constant
+ * @details HostEndianness can not be evaluated in constant expressions. This constant is used to select conversion
+ * kernels at compile time.
+ */
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr Order HostOrder = Order::Big;
+#else
+constexpr Order HostOrder = Order::Little;
+#endif
+
+/**
+ * @brief implementation details (not part of the public api)
+ */
+namespace detail {
+
+/**
+ * @brief unsigned integer type with the given size in bytes
+ * @tparam W size in bytes
+ */
+template <std::size_t W>
+struct Uint_Of {};
+
+template <>
+struct Uint_Of<1> {
+    using type = std::uint8_t;
+};
+
+template <>
+struct Uint_Of<2> {
+    using type = std::uint16_t;
+};
+
+template <>
+struct Uint_Of<4> {
+    using type = std::uint32_t;
+};
+
+template <>
+struct Uint_Of<8> {
+    using type = std::uint64_t;
+};
+
+inline std::uint8_t bswap(std::uint8_t v) noexcept {
+    return v;
+}
+
+inline std::uint16_t bswap(std::uint16_t v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap16(v);
+#elif defined(_MSC_VER)
+    return _byteswap_ushort(v);
+#else
+    return static_cast<std::uint16_t>((v >> 8) | (v << 8));
+#endif
+}
+
+inline std::uint32_t bswap(std::uint32_t v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(v);
+#elif defined(_MSC_VER)
+    return _byteswap_ulong(v);
+#else
+    return ((v & 0x000000FFu) << 24) | ((v & 0x0000FF00u) << 8) | ((v & 0x00FF0000u) >> 8) |
+           ((v & 0xFF000000u) >> 24);
+#endif
+}
+
+inline std::uint64_t bswap(std::uint64_t v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(v);
+#elif defined(_MSC_VER)
+    return _byteswap_uint64(v);
+#else
+    return (static_cast<std::uint64_t>(bswap(static_cast<std::uint32_t>(v))) << 32) |
+           bswap(static_cast<std::uint32_t>(v >> 32));
+#endif
+}
+
+/**
+ * @brief bit pattern of a value as unsigned integer of the same size
+ * @param v value
+ * @return bit pattern
+ */
+template <typename T>
+inline typename Uint_Of<sizeof(T)>::type to_bits(T v) noexcept {
+    typename Uint_Of<sizeof(T)>::type u;
+    std::memcpy(&u, &v, sizeof(T));
+    return u;
+}
+
+/**
+ * @brief value with the given bit pattern
+ * @tparam T data type
+ * @param u bit pattern
+ * @return value
+ */
+template <typename T>
+inline T from_bits(typename Uint_Of<sizeof(T)>::type u) noexcept {
+    T v;
+    std::memcpy(&v, &u, sizeof(T));
+    return v;
+}
+
+/**
+ * @brief load value stored in byte order order
+ * @tparam order byte order of the stored value
+ * @tparam T base data type (integer or floating point)
+ * @param src source (sizeof(T) bytes, any alignment)
+ * @return value in host byte order
+ */
+template <Order order, typename T>
+inline T load(const void *src) noexcept {
+    typename Uint_Of<sizeof(T)>::type u;
+    std::memcpy(&u, src, sizeof(T));
+    if constexpr (order != HostOrder) u = bswap(u);
+    return from_bits<T>(u);
+}
+
+/**
+ * @brief store value in byte order order
+ * @tparam order byte order of the stored value
+ * @tparam T base data type (integer or floating point)
+ * @param dst destination (sizeof(T) bytes, any alignment)
+ * @param v value in host byte order
+ */
+template <Order order, typename T>
+inline void store(void *dst, T v) noexcept {
+    auto u = to_bits(v);
+    if constexpr (order != HostOrder) u = bswap(u);
+    std::memcpy(dst, &u, sizeof(T));
+}
+
+}  // namespace detail
+
 /**
  * @brief swap endianness
+ * @details Types with a size of 2, 4 or 8 bytes are swapped via an unsigned integer and the compiler builtin. This
+ * compiles to a single bswap/rol (or movbe if the value is loaded from or stored to memory). Other types are swapped
+ * byte by byte.
  * @tparam T data type
  * @param i input
  * @return swapped endianness
@@ -54,11 +205,15 @@ template <typename T>
 [[maybe_unused]] static T swap(const T &i) {
     T ret;
 
-    auto *dst = reinterpret_cast<uint8_t *>(&ret);
-    auto *src = reinterpret_cast<const uint8_t *>(&i + 1);
+    if constexpr ((sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8) && std::is_trivially_copyable<T>::value) {
+        ret = detail::from_bits<T>(detail::bswap(detail::to_bits(i)));
+    } else {
+        auto *dst = reinterpret_cast<uint8_t *>(&ret);
+        auto *src = reinterpret_cast<const uint8_t *>(&i + 1);
 
-    for (std::size_t j = 0; j < sizeof(T); j++)
-        *dst++ = *--src;
+        for (std::size_t j = 0; j < sizeof(T); j++)
+            *dst++ = *--src;
+    }
 
     return ret;
 }
@@ -72,6 +227,7 @@ template <typename T>
  */
 template <typename T>
 [[maybe_unused]] static T big_to_little(const T &b) {
+    CXXENDIAN_COUNT_SCALAR(instrument::Direction::Swap, sizeof(T));
     return swap(b);
 }
 
@@ -84,6 +240,7 @@ template <typename T>
  */
 template <typename T>
 [[maybe_unused]] static T little_to_big(const T &l) {
+    CXXENDIAN_COUNT_SCALAR(instrument::Direction::Swap, sizeof(T));
     return swap(l);
 }
 
@@ -95,6 +252,7 @@ template <typename T>
  */
 template <typename T>
 [[maybe_unused]] static T host_to_big(const T &b) {
+    CXXENDIAN_COUNT_SCALAR(instrument::Direction::Host_To_Big, sizeof(T));
     return HostEndianness.isLittle() ? swap(b) : b;
 }
 
@@ -106,6 +264,7 @@ template <typename T>
  */
 template <typename T>
 [[maybe_unused]] static T host_to_little(const T &h) {
+    CXXENDIAN_COUNT_SCALAR(instrument::Direction::Host_To_Little, sizeof(T));
     return HostEndianness.isBig() ? swap(h) : h;
 }
 
@@ -117,6 +276,7 @@ template <typename T>
  */
 template <typename T>
 [[maybe_unused]] static T big_to_host(const T &b) {
+    CXXENDIAN_COUNT_SCALAR(instrument::Direction::Big_To_Host, sizeof(T));
     return HostEndianness.isLittle() ? swap(b) : b;
 }
 
@@ -128,6 +288,7 @@ template <typename T>
  */
 template <typename T>
 [[maybe_unused]] static T little_to_host(const T &l) {
+    CXXENDIAN_COUNT_SCALAR(instrument::Direction::Little_To_Host, sizeof(T));
     return HostEndianness.isBig() ? swap(l) : l;
 }
 
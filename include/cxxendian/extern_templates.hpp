@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "float.hpp"
+#include "int.hpp"
+
+/*
+ * Explicit instantiations of the endian types for all fixed width integer types, float and double.
+ *
+ * If CXXENDIAN_EXTERN_TEMPLATES is defined, the instantiations are only declared (extern template). The member
+ * functions, virtual functions and vtables of these types are then no longer instantiated and emitted in every
+ * translation unit but only once in the library target cxxendian_compiled (src/instantiations.cpp), which defines
+ * CXXENDIAN_EXTERN_TEMPLATES for all targets that link it. Inline member functions can still be inlined.
+ *
+ * The operators are small function templates that are always inlined and therefore not part of the instantiations.
+ */
+
+//* instantiate (PREFIX = empty) or declare (PREFIX = extern) all integer types with base data type T
+#define CXXENDIAN_INSTANTIATE_INT(PREFIX, T)                                                                           \
+    PREFIX template class Base_Int<T>;                                                                                 \
+    PREFIX template class LE_Int<T>;                                                                                   \
+    PREFIX template class BE_Int<T>;                                                                                   \
+    PREFIX template class Host_Int<T>;
+
+//* instantiate (PREFIX = empty) or declare (PREFIX = extern) all floating point types with base data type T
+#define CXXENDIAN_INSTANTIATE_FLOAT(PREFIX, T)                                                                         \
+    PREFIX template class Base_Float<T>;                                                                               \
+    PREFIX template class LE_Float<T>;                                                                                 \
+    PREFIX template class BE_Float<T>;                                                                                 \
+    PREFIX template class Host_Float<T>;
+
+//* instantiate (PREFIX = empty) or declare (PREFIX = extern) all common types (use in namespace cxxendian)
+#define CXXENDIAN_INSTANTIATE_ALL(PREFIX)                                                                              \
+    CXXENDIAN_INSTANTIATE_INT(PREFIX, std::int8_t)                                                                     \
+    CXXENDIAN_INSTANTIATE_INT(PREFIX, std::uint8_t)                                                                    \
+    CXXENDIAN_INSTANTIATE_INT(PREFIX, std::int16_t)                                                                    \
+    CXXENDIAN_INSTANTIATE_INT(PREFIX, std::uint16_t)                                                                   \
+    CXXENDIAN_INSTANTIATE_INT(PREFIX, std::int32_t)                                                                    \
+    CXXENDIAN_INSTANTIATE_INT(PREFIX, std::uint32_t)                                                                   \
+    CXXENDIAN_INSTANTIATE_INT(PREFIX, std::int64_t)                                                                    \
+    CXXENDIAN_INSTANTIATE_INT(PREFIX, std::uint64_t)                                                                   \
+    CXXENDIAN_INSTANTIATE_FLOAT(PREFIX, float)                                                                         \
+    CXXENDIAN_INSTANTIATE_FLOAT(PREFIX, double)
+
+#if defined(CXXENDIAN_EXTERN_TEMPLATES)
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace cxxendian {
+
+CXXENDIAN_INSTANTIATE_ALL(extern)
+
+}  // namespace cxxendian
+#endif
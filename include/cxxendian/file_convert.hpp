@@ -0,0 +1,446 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#    error "cxxendian/file_convert.hpp requires a POSIX system (pread/pwrite)"
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if defined(__linux__) && !defined(CXXENDIAN_NO_IO_URING) && defined(__has_include)
+#    if __has_include(<linux/io_uring.h>)
+#        define CXXENDIAN_HAVE_IO_URING
+#        include <linux/io_uring.h>
+#        include <sys/syscall.h>
+#    endif
+#endif
+
+#include "bulk.hpp"
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace cxxendian {
+
+/**
+ * @brief parameters of swap_file
+ */
+struct File_Convert_Params {
+    //* size of one buffer in bytes (rounded down to a multiple of the element size, at most 1 GiB and the file size)
+    std::size_t buffer_bytes = std::size_t(1) << 20;
+    //* number of buffers, i.e. number of reads/writes in flight (io_uring only)
+    unsigned queue_depth = 8;
+    //* use io_uring if available (false: always use the pread/pwrite loop)
+    bool use_io_uring = true;
+};
+
+/**
+ * @brief statistics of swap_file
+ */
+struct File_Convert_Stats {
+    //* number of converted bytes
+    std::uint64_t bytes = 0;
+    //* true if io_uring was used
+    bool io_uring = false;
+};
+
+namespace detail {
+
+/**
+ * @brief anonymous page aligned memory (freed on destruction)
+ */
+class Page_Buffer {
+    void       *ptr = MAP_FAILED;
+    std::size_t len;
+
+public:
+    explicit Page_Buffer(std::size_t bytes) noexcept : len(bytes) {
+        ptr = mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+
+    Page_Buffer(const Page_Buffer &)            = delete;
+    Page_Buffer &operator=(const Page_Buffer &) = delete;
+
+    ~Page_Buffer() {
+        if (ptr != MAP_FAILED) munmap(ptr, len);
+    }
+
+    bool ok() const noexcept { return ptr != MAP_FAILED; }
+
+    std::uint8_t *data() const noexcept { return static_cast<std::uint8_t *>(ptr); }
+};
+
+/**
+ * @brief blocking read/convert/write loop
+ */
+template <std::size_t W>
+inline bool swap_file_sync(int in_fd, int out_fd, std::uint64_t size, std::size_t buffer_bytes) noexcept {
+    Page_Buffer buffer(buffer_bytes);
+    if (!buffer.ok()) return false;
+
+#if defined(POSIX_FADV_SEQUENTIAL)
+    posix_fadvise(in_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    for (std::uint64_t off = 0; off < size;) {
+        const auto len = static_cast<std::size_t>(std::min<std::uint64_t>(buffer_bytes, size - off));
+
+        for (std::size_t done = 0; done < len;) {
+            const ssize_t r = pread(in_fd, buffer.data() + done, len - done, static_cast<off_t>(off + done));
+            if (r < 0 && errno == EINTR) continue;
+            if (r <= 0) {
+                if (r == 0) errno = EIO;  // file was truncated
+                return false;
+            }
+            done += static_cast<std::size_t>(r);
+        }
+
+        endian::detail::swap_bytes<W>(buffer.data(), buffer.data(), len / W);
+
+        for (std::size_t done = 0; done < len;) {
+            const ssize_t r = pwrite(out_fd, buffer.data() + done, len - done, static_cast<off_t>(off + done));
+            if (r < 0 && errno == EINTR) continue;
+            if (r < 0) return false;
+            done += static_cast<std::size_t>(r);
+        }
+
+        off += len;
+    }
+    return true;
+}
+
+#if defined(CXXENDIAN_HAVE_IO_URING)
+
+/**
+ * @brief minimal io_uring instance (raw system calls, no liburing)
+ */
+class Uring {
+    int fd = -1;
+
+    void       *sq_ring = MAP_FAILED;
+    void       *cq_ring = MAP_FAILED;
+    std::size_t sq_ring_bytes;
+    std::size_t cq_ring_bytes;
+
+    io_uring_sqe *sqes = static_cast<io_uring_sqe *>(MAP_FAILED);
+    std::size_t   sqes_bytes;
+
+    unsigned *sq_head;
+    unsigned *sq_tail;
+    unsigned *sq_mask;
+    unsigned *sq_array;
+    unsigned  sq_local_tail = 0;
+
+    unsigned     *cq_head;
+    unsigned     *cq_tail;
+    unsigned     *cq_mask;
+    io_uring_cqe *cqes;
+
+    static unsigned *field(void *ring, unsigned offset) noexcept {
+        return reinterpret_cast<unsigned *>(static_cast<std::uint8_t *>(ring) + offset);
+    }
+
+public:
+    /**
+     * @brief create io_uring instance
+     * @param entries number of submission queue entries
+     */
+    explicit Uring(unsigned entries) noexcept {
+        io_uring_params p {};
+        fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &p));
+        if (fd < 0) return;
+
+        sq_ring_bytes = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+        cq_ring_bytes = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+        if (p.features & IORING_FEAT_SINGLE_MMAP) {
+            if (cq_ring_bytes > sq_ring_bytes) sq_ring_bytes = cq_ring_bytes;
+            cq_ring_bytes = sq_ring_bytes;
+        }
+
+        sq_ring = mmap(
+                nullptr, sq_ring_bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        if (sq_ring == MAP_FAILED) return;
+        if (p.features & IORING_FEAT_SINGLE_MMAP) {
+            cq_ring = sq_ring;
+        } else {
+            cq_ring = mmap(
+                    nullptr, cq_ring_bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+            if (cq_ring == MAP_FAILED) return;
+        }
+
+        sqes_bytes = p.sq_entries * sizeof(io_uring_sqe);
+        void *s    = mmap(nullptr, sqes_bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        if (s == MAP_FAILED) return;
+        sqes = static_cast<io_uring_sqe *>(s);
+
+        sq_head       = field(sq_ring, p.sq_off.head);
+        sq_tail       = field(sq_ring, p.sq_off.tail);
+        sq_mask       = field(sq_ring, p.sq_off.ring_mask);
+        sq_array      = field(sq_ring, p.sq_off.array);
+        sq_local_tail = *sq_tail;
+
+        cq_head = field(cq_ring, p.cq_off.head);
+        cq_tail = field(cq_ring, p.cq_off.tail);
+        cq_mask = field(cq_ring, p.cq_off.ring_mask);
+        cqes    = reinterpret_cast<io_uring_cqe *>(static_cast<std::uint8_t *>(cq_ring) + p.cq_off.cqes);
+    }
+
+    Uring(const Uring &)            = delete;
+    Uring &operator=(const Uring &) = delete;
+
+    ~Uring() {
+        if (sqes != MAP_FAILED) munmap(sqes, sqes_bytes);
+        if (cq_ring != MAP_FAILED && cq_ring != sq_ring) munmap(cq_ring, cq_ring_bytes);
+        if (sq_ring != MAP_FAILED) munmap(sq_ring, sq_ring_bytes);
+        if (fd >= 0) close(fd);
+    }
+
+    //* true if the instance is usable
+    bool ok() const noexcept { return fd >= 0 && sqes != MAP_FAILED; }
+
+    /**
+     * @brief register fixed buffers
+     * @param iov buffers
+     * @param n number of buffers
+     * @return true on success
+     */
+    bool register_buffers(const iovec *iov, unsigned n) noexcept {
+        return syscall(__NR_io_uring_register, fd, IORING_REGISTER_BUFFERS, iov, n) == 0;
+    }
+
+    /**
+     * @brief queue a read or write from a fixed buffer (the queue must not be full)
+     * @param op IORING_OP_READ_FIXED or IORING_OP_WRITE_FIXED
+     * @param file file descriptor
+     * @param buf buffer (inside fixed buffer index)
+     * @param len number of bytes (less than 4 GiB)
+     * @param offset file offset
+     * @param index index of the fixed buffer
+     * @param user_data returned in the completion
+     */
+    void prepare(std::uint8_t  op,
+                 int           file,
+                 void         *buf,
+                 std::size_t   len,
+                 std::uint64_t offset,
+                 unsigned      index,
+                 std::uint64_t user_data) noexcept {
+        const unsigned idx = sq_local_tail & *sq_mask;
+        io_uring_sqe  &sqe = sqes[idx];
+        sqe                = io_uring_sqe {};
+        sqe.opcode         = op;
+        sqe.fd             = file;
+        sqe.addr           = reinterpret_cast<std::uint64_t>(buf);
+        sqe.len            = static_cast<std::uint32_t>(len);
+        sqe.off            = offset;
+        sqe.buf_index      = static_cast<std::uint16_t>(index);
+        sqe.user_data      = user_data;
+        sq_array[idx]      = idx;
+        ++sq_local_tail;
+    }
+
+    /**
+     * @brief submit all prepared entries and wait for at least one completion
+     * @return true on success
+     */
+    bool submit_and_wait() noexcept {
+        const unsigned to_submit = sq_local_tail - *sq_tail;
+        __atomic_store_n(sq_tail, sq_local_tail, __ATOMIC_RELEASE);
+        for (;;) {
+            const long r = syscall(__NR_io_uring_enter, fd, to_submit, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+            if (r >= 0) return true;
+            if (errno != EINTR) return false;
+        }
+    }
+
+    /**
+     * @brief call f(user_data, res) for every available completion
+     * @tparam F callable
+     * @param f callback
+     */
+    template <typename F>
+    void for_each_completion(F &&f) {
+        unsigned       head = *cq_head;
+        const unsigned tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+        for (; head != tail; ++head) {
+            const io_uring_cqe &cqe = cqes[head & *cq_mask];
+            f(cqe.user_data, cqe.res);
+        }
+        __atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+    }
+};
+
+/**
+ * @brief io_uring pipeline: queue_depth buffers, each either reading or writing
+ * @return 1 on success, 0 on error (errno), -1 if io_uring is not available
+ */
+template <std::size_t W>
+inline int swap_file_uring(int in_fd, int out_fd, std::uint64_t size, std::size_t buffer_bytes, unsigned depth) {
+    Uring ring(depth * 2);
+    if (!ring.ok()) return -1;
+
+    Page_Buffer memory(buffer_bytes * depth);
+    if (!memory.ok()) return 0;
+
+    struct Slot {
+        iovec         iov;
+        std::uint64_t offset;
+        std::size_t   len;
+        std::size_t   done;
+        bool          writing;
+    };
+    constexpr unsigned MAX_DEPTH = 64;
+    Slot               slots[MAX_DEPTH];
+    iovec              iovs[MAX_DEPTH];
+    for (unsigned i = 0; i < depth; ++i) {
+        iovs[i]  = {memory.data() + i * buffer_bytes, buffer_bytes};
+        slots[i] = {iovs[i], 0, 0, 0, false};
+    }
+    if (!ring.register_buffers(iovs, depth)) return -1;
+
+    std::uint64_t next_offset = 0;
+    unsigned      in_flight   = 0;
+
+    auto submit = [&](unsigned i) {
+        Slot &s = slots[i];
+        ring.prepare(s.writing ? IORING_OP_WRITE_FIXED : IORING_OP_READ_FIXED,
+                     s.writing ? out_fd : in_fd,
+                     static_cast<std::uint8_t *>(s.iov.iov_base) + s.done,
+                     s.len - s.done,
+                     s.offset + s.done,
+                     i,
+                     i);
+    };
+
+    auto start_read = [&](unsigned i) {
+        Slot &s = slots[i];
+        s.offset = next_offset;
+        s.len    = static_cast<std::size_t>(std::min<std::uint64_t>(buffer_bytes, size - next_offset));
+        s.done    = 0;
+        s.writing = false;
+        next_offset += s.len;
+        ++in_flight;
+        submit(i);
+    };
+
+    for (unsigned i = 0; i < depth && next_offset < size; ++i)
+        start_read(i);
+
+    int error = 0;
+    while (in_flight) {
+        if (!ring.submit_and_wait()) return 0;
+
+        ring.for_each_completion([&](std::uint64_t user_data, std::int32_t res) {
+            const auto i = static_cast<unsigned>(user_data);
+            Slot      &s = slots[i];
+
+            if (res <= 0) {
+                // error or unexpected end of file: let the other requests finish
+                if (!error) error = res < 0 ? -res : EIO;
+                --in_flight;
+                return;
+            }
+
+            s.done += static_cast<std::size_t>(res);
+            if (error) {
+                --in_flight;
+                return;
+            }
+            if (s.done < s.len) {
+                submit(i);  // short read or write: continue
+                return;
+            }
+
+            if (!s.writing) {
+                endian::detail::swap_bytes<W>(s.iov.iov_base, s.iov.iov_base, s.len / W);
+                s.writing = true;
+                s.done    = 0;
+                submit(i);
+            } else {
+                --in_flight;
+                if (next_offset < size) start_read(i);
+            }
+        });
+    }
+
+    if (error) {
+        errno = error;
+        return 0;
+    }
+    return 1;
+}
+
+#endif
+
+}  // namespace detail
+
+/**
+ * @brief convert a file of elements of type T to the other byte order
+ * @details
+ * The file is read in blocks of params.buffer_bytes. Each block is converted in place with the bulk kernels and
+ * written to the same offset of out_fd. in_fd and out_fd may refer to the same file (in place conversion).
+ *
+ * On Linux, io_uring is used if the kernel supports it. Up to params.queue_depth reads and writes are in flight at
+ * the same time, the buffers are registered as fixed buffers. Otherwise (or if the io_uring setup fails, e.g. because
+ * it is disabled by a seccomp filter) a blocking pread/pwrite loop is used.
+ *
+ * The size of the input file must be a multiple of sizeof(T). Trailing bytes are copied unchanged.
+ *
+ * @tparam T element type (1, 2, 4, 8 or 16 bytes)
+ * @param in_fd input file (regular file, opened for reading)
+ * @param out_fd output file (opened for writing)
+ * @param params buffer size and queue depth
+ * @param stats statistics (optional, set on success only)
+ * @return true on success, false on error (see errno)
+ */
+template <typename T>
+inline bool swap_file(int                  in_fd,
+                      int                  out_fd,
+                      File_Convert_Params  params = File_Convert_Params(),
+                      File_Convert_Stats  *stats  = nullptr) noexcept {
+    constexpr std::size_t W = sizeof(T);
+
+    struct stat st {};
+    if (fstat(in_fd, &st) != 0) return false;
+    const auto size = static_cast<std::uint64_t>(st.st_size);
+
+    // io_uring requests have a 32 bit length: limit the buffers to 1 GiB (and to the file, the rest is never used)
+    constexpr std::size_t MAX_BUFFER   = std::size_t(1) << 30;
+    std::size_t           buffer_bytes = std::min(params.buffer_bytes, MAX_BUFFER);
+    buffer_bytes = static_cast<std::size_t>(std::min<std::uint64_t>(buffer_bytes, size)) / W * W;
+    if (buffer_bytes < 4096) buffer_bytes = 4096 / W * W;
+    unsigned depth = params.queue_depth ? params.queue_depth : 1;
+    if (depth > 64) depth = 64;
+
+    bool ok       = false;
+    bool io_uring = false;
+#if defined(CXXENDIAN_HAVE_IO_URING)
+    if (params.use_io_uring && size) {
+        const int r = detail::swap_file_uring<W>(in_fd, out_fd, size, buffer_bytes, depth);
+        io_uring    = r >= 0;
+        ok          = r == 1;
+    }
+#endif
+    if (!io_uring) ok = detail::swap_file_sync<W>(in_fd, out_fd, size, buffer_bytes);
+    if (!ok) return false;
+
+    if (stats) *stats = File_Convert_Stats {size, io_uring};
+    CXXENDIAN_COUNT_BULK(endian::instrument::Direction::Swap, W, size / W);
+    return true;
+}
+
+}  // namespace cxxendian
@@ -14,12 +14,6 @@
  */
 namespace cxxendian {
 
-template <typename T>
-class LE_Float;
-
-template <typename T>
-class BE_Float;
-
 /**
  * @brief class that represents a floating point value using little endian
  * @tparam T data type (floating point only)
@@ -31,7 +25,7 @@ public:
      * @brief create from base data type
      * @param v value
      */
-    explicit LE_Float(T v) noexcept : Base_Float<T>(endian::little_to_host(v)) {}
+    explicit LE_Float(T v) noexcept : Base_Float<T>(endian::host_to_little(endian::detail::to_bits(v))) {}
 
     /**
      * @brief copy constructor
@@ -39,7 +33,8 @@ public:
      * @param other other instance
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
-    explicit LE_Float(const Base_Float<t_other> &other) noexcept : Base_Float<T>(other.get_raw()) {}
+    explicit LE_Float(const Base_Float<t_other> &other) noexcept
+            : Base_Float<T>(endian::host_to_little(other.get_bits())) {}
 
     /**
      * @brief move constructor
@@ -47,7 +42,8 @@ public:
      * @param other other instance
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
-    explicit LE_Float(Base_Float<t_other> &&other) noexcept : Base_Float<T>(other.get_raw()) {}
+    explicit LE_Float(Base_Float<t_other> &&other) noexcept
+            : Base_Float<T>(endian::host_to_little(other.get_bits())) {}
 
     /**
      * @brief create from int type (type conversion)
@@ -55,7 +51,8 @@ public:
      * @param other other instance
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_integral<t_other>::value>>
-    explicit LE_Float(Base_Int<t_other> &other) noexcept : Base_Float<T>(static_cast<T>(other.get_raw())) {}
+    explicit LE_Float(const Base_Int<t_other> &other) noexcept
+            : Base_Float<T>(endian::host_to_little(endian::detail::to_bits(static_cast<T>(other.get())))) {}
 
     /**
      * @brief assign from float type with any endianness
@@ -65,7 +62,7 @@ public:
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
     LE_Float<T> &operator=(const Base_Float<t_other> &other) noexcept {
-        Base_Float<T>::data = other.data;
+        set_bits(other.get_bits());
         return *this;
     }
 
@@ -77,7 +74,7 @@ public:
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
     LE_Float<T> &operator=(Base_Float<t_other> &&other) noexcept {
-        Base_Float<T>::data = other.data;
+        set_bits(other.get_bits());
         return *this;
     }
 
@@ -87,7 +84,7 @@ public:
      * @return this instance
      */
     LE_Float<T> &operator=(T v) noexcept {
-        Base_Float<T>::data = v;
+        set(v);
         return *this;
     }
 
@@ -95,7 +92,31 @@ public:
      * @brief get data in the actual endianness of the object
      * @return data in the objects endianness
      */
-    inline T get() const noexcept override { return endian::host_to_little(Base_Float<T>::data); }
+    inline T get() const noexcept override {
+        return endian::detail::from_bits<T>(endian::little_to_host(Base_Float<T>::data));
+    }
+
+    /**
+     * @brief set the value
+     * @param v value in host endian
+     */
+    inline void set(T v) noexcept override { Base_Float<T>::data = endian::host_to_little(endian::detail::to_bits(v)); }
+
+    /**
+     * @brief get the bit pattern of the value in host endian
+     * @return bit pattern in host endian
+     */
+    inline typename Base_Float<T>::Raw get_bits() const noexcept override {
+        return endian::little_to_host(Base_Float<T>::data);
+    }
+
+    /**
+     * @brief set the value from its bit pattern
+     * @param bits bit pattern in host endian
+     */
+    inline void set_bits(typename Base_Float<T>::Raw bits) noexcept override {
+        Base_Float<T>::data = endian::host_to_little(bits);
+    }
 
     //* default destructor
     ~LE_Float() override = default;
@@ -112,7 +133,7 @@ public:
      * @brief create from base data type
      * @param v value
      */
-    explicit BE_Float(T v) noexcept : Base_Float<T>(endian::big_to_host(v)) {}
+    explicit BE_Float(T v) noexcept : Base_Float<T>(endian::host_to_big(endian::detail::to_bits(v))) {}
 
     /**
      * @brief copy constructor
@@ -120,7 +141,8 @@ public:
      * @param other other instance
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
-    explicit BE_Float(const Base_Float<t_other> &other) noexcept : Base_Float<T>(other.get_raw()) {}
+    explicit BE_Float(const Base_Float<t_other> &other) noexcept
+            : Base_Float<T>(endian::host_to_big(other.get_bits())) {}
 
     /**
      * @brief move constructor
@@ -128,7 +150,8 @@ public:
      * @param other other instance
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
-    explicit BE_Float(Base_Float<t_other> &&other) noexcept : Base_Float<T>(other.get_raw()) {}
+    explicit BE_Float(Base_Float<t_other> &&other) noexcept
+            : Base_Float<T>(endian::host_to_big(other.get_bits())) {}
 
     /**
      * @brief create from int type (type conversion)
@@ -136,7 +159,8 @@ public:
      * @param other other instance
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_integral<t_other>::value>>
-    explicit BE_Float(Base_Int<t_other> &other) noexcept : Base_Float<T>(static_cast<T>(other.get_raw())) {}
+    explicit BE_Float(const Base_Int<t_other> &other) noexcept
+            : Base_Float<T>(endian::host_to_big(endian::detail::to_bits(static_cast<T>(other.get())))) {}
 
     /**
      * @brief assign from float type with any endianness
@@ -146,7 +170,7 @@ public:
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
     BE_Float<T> &operator=(const Base_Float<t_other> &other) noexcept {
-        Base_Float<T>::data = other.data;
+        set_bits(other.get_bits());
         return *this;
     }
 
@@ -158,7 +182,7 @@ public:
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
     BE_Float<T> &operator=(Base_Float<t_other> &&other) noexcept {
-        Base_Float<T>::data = other.data;
+        set_bits(other.get_bits());
         return *this;
     }
 
@@ -168,7 +192,7 @@ public:
      * @return this instance
      */
     BE_Float<T> &operator=(T v) noexcept {
-        Base_Float<T>::data = v;
+        set(v);
         return *this;
     }
 
@@ -176,7 +200,31 @@ public:
      * @brief get data in the actual endianness of the object
      * @return data in the objects endianness
      */
-    inline T get() const noexcept override { return endian::host_to_big(Base_Float<T>::data); }
+    inline T get() const noexcept override {
+        return endian::detail::from_bits<T>(endian::big_to_host(Base_Float<T>::data));
+    }
+
+    /**
+     * @brief set the value
+     * @param v value in host endian
+     */
+    inline void set(T v) noexcept override { Base_Float<T>::data = endian::host_to_big(endian::detail::to_bits(v)); }
+
+    /**
+     * @brief get the bit pattern of the value in host endian
+     * @return bit pattern in host endian
+     */
+    inline typename Base_Float<T>::Raw get_bits() const noexcept override {
+        return endian::big_to_host(Base_Float<T>::data);
+    }
+
+    /**
+     * @brief set the value from its bit pattern
+     * @param bits bit pattern in host endian
+     */
+    inline void set_bits(typename Base_Float<T>::Raw bits) noexcept override {
+        Base_Float<T>::data = endian::host_to_big(bits);
+    }
 
     //* default destructor
     ~BE_Float() override = default;
@@ -193,7 +241,8 @@ public:
      * @brief create from base data type
      * @param v value
      */
-    Host_Float(T v) noexcept : Base_Float<T>(v) {}  // NOLINT: non-explicit constructor is intentional
+    Host_Float(T v) noexcept  // NOLINT: non-explicit constructor is intentional
+            : Base_Float<T>(endian::detail::to_bits(v)) {}
 
     /**
      * @brief copy constructor
@@ -201,7 +250,7 @@ public:
      * @param other other instance
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
-    explicit Host_Float(const Base_Float<t_other> &other) noexcept : Base_Float<T>(other.get_raw()) {}
+    explicit Host_Float(const Base_Float<t_other> &other) noexcept : Base_Float<T>(other.get_bits()) {}
 
     /**
      * @brief move constructor
@@ -209,7 +258,7 @@ public:
      * @param other other instance
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
-    explicit Host_Float(Base_Float<t_other> &&other) noexcept : Base_Float<T>(other.get_raw()) {}
+    explicit Host_Float(Base_Float<t_other> &&other) noexcept : Base_Float<T>(other.get_bits()) {}
 
     /**
      * @brief create from int type (type conversion)
@@ -217,7 +266,8 @@ public:
      * @param other other instance
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_integral<t_other>::value>>
-    explicit Host_Float(Base_Int<t_other> &other) noexcept : Base_Float<T>(static_cast<T>(other.get_raw())) {}
+    explicit Host_Float(const Base_Int<t_other> &other) noexcept
+            : Base_Float<T>(endian::detail::to_bits(static_cast<T>(other.get()))) {}
 
     /**
      * @brief assign from float type with any endianness
@@ -227,7 +277,7 @@ public:
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
     Host_Float<T> &operator=(const Base_Float<t_other> &other) noexcept {
-        Base_Float<T>::data = other.data;
+        set_bits(other.get_bits());
         return *this;
     }
 
@@ -239,7 +289,7 @@ public:
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
     Host_Float<T> &operator=(Base_Float<t_other> &&other) noexcept {
-        Base_Float<T>::data = other.data;
+        set_bits(other.get_bits());
         return *this;
     }
 
@@ -249,7 +299,7 @@ public:
      * @return this instance
      */
     Host_Float<T> &operator=(T v) noexcept {
-        Base_Float<T>::data = v;
+        set(v);
         return *this;
     }
 
@@ -257,7 +307,25 @@ public:
      * @brief get data in the actual endianness of the object
      * @return data in the objects endianness
      */
-    inline T get() const noexcept override { return Base_Float<T>::data; }
+    inline T get() const noexcept override { return endian::detail::from_bits<T>(Base_Float<T>::data); }
+
+    /**
+     * @brief set the value
+     * @param v value in host endian
+     */
+    inline void set(T v) noexcept override { Base_Float<T>::data = endian::detail::to_bits(v); }
+
+    /**
+     * @brief get the bit pattern of the value in host endian
+     * @return bit pattern in host endian
+     */
+    inline typename Base_Float<T>::Raw get_bits() const noexcept override { return Base_Float<T>::data; }
+
+    /**
+     * @brief set the value from its bit pattern
+     * @param bits bit pattern in host endian
+     */
+    inline void set_bits(typename Base_Float<T>::Raw bits) noexcept override { Base_Float<T>::data = bits; }
 
     //* default destructor
     ~Host_Float() override = default;
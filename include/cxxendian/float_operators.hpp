@@ -5,6 +5,9 @@
 
 #pragma once
 
+#include <cmath>
+#include <iosfwd>
+
 #include "float.hpp"
 
 /**
@@ -21,7 +24,7 @@ namespace cxxendian {
  */
 template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
 inline Host_Float<T> operator+(const Base_Float<T, void> &a, const Base_Float<T, void> &b) noexcept {
-    return Host_Float<T>(a.get_raw() + b.get_raw());
+    return Host_Float<T>(a.get() + b.get());
 }
 
 /**
@@ -33,7 +36,7 @@ inline Host_Float<T> operator+(const Base_Float<T, void> &a, const Base_Float<T,
  */
 template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
 inline Base_Float<T> &operator+=(Base_Float<T, void> &a, const Base_Float<T, void> &b) noexcept {
-    a.get_raw() += b.get_raw();
+    a.set(a.get() + b.get());
     return a;
 }
 
@@ -46,7 +49,7 @@ inline Base_Float<T> &operator+=(Base_Float<T, void> &a, const Base_Float<T, voi
  */
 template <typename T>
 inline Host_Float<T> operator-(const Base_Float<T, void> &a, const Base_Float<T, void> &b) noexcept {
-    return Host_Float<T>(a.get_raw() - b.get_raw());
+    return Host_Float<T>(a.get() - b.get());
 }
 
 /**
@@ -58,7 +61,7 @@ inline Host_Float<T> operator-(const Base_Float<T, void> &a, const Base_Float<T,
  */
 template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
 inline Base_Float<T> &operator-=(Base_Float<T, void> &a, const Base_Float<T, void> &b) noexcept {
-    a.get_raw() -= b.get_raw();
+    a.set(a.get() - b.get());
     return a;
 }
 
@@ -71,7 +74,7 @@ inline Base_Float<T> &operator-=(Base_Float<T, void> &a, const Base_Float<T, voi
  */
 template <typename T>
 inline Host_Float<T> operator*(const Base_Float<T, void> &a, const Base_Float<T, void> &b) noexcept {
-    return Host_Float<T>(a.get_raw() * b.get_raw());
+    return Host_Float<T>(a.get() * b.get());
 }
 
 /**
@@ -83,7 +86,7 @@ inline Host_Float<T> operator*(const Base_Float<T, void> &a, const Base_Float<T,
  */
 template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
 inline Base_Float<T> &operator*=(Base_Float<T, void> &a, const Base_Float<T, void> &b) noexcept {
-    a.get_raw() *= b.get_raw();
+    a.set(a.get() * b.get());
     return a;
 }
 
@@ -96,7 +99,7 @@ inline Base_Float<T> &operator*=(Base_Float<T, void> &a, const Base_Float<T, voi
  */
 template <typename T>
 inline Host_Float<T> operator/(const Base_Float<T, void> &a, const Base_Float<T, void> &b) noexcept {
-    return Host_Float<T>(a.get_raw() / b.get_raw());
+    return Host_Float<T>(a.get() / b.get());
 }
 
 /**
@@ -108,7 +111,7 @@ inline Host_Float<T> operator/(const Base_Float<T, void> &a, const Base_Float<T,
  */
 template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
 inline Base_Float<T> &operator/=(Base_Float<T, void> &a, const Base_Float<T, void> &b) noexcept {
-    a.get_raw() /= b.get_raw();
+    a.set(a.get() / b.get());
     return a;
 }
 
@@ -121,7 +124,7 @@ inline Base_Float<T> &operator/=(Base_Float<T, void> &a, const Base_Float<T, voi
  */
 template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
 inline Host_Float<T> operator%(const Base_Float<T, void> &a, const Base_Float<T, void> &b) noexcept {
-    return Host_Float<T>(a.get_raw() % b.get_raw());
+    return Host_Float<T>(std::fmod(a.get(), b.get()));
 }
 
 /**
@@ -133,7 +136,7 @@ inline Host_Float<T> operator%(const Base_Float<T, void> &a, const Base_Float<T,
  */
 template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
 inline Base_Float<T> &operator%=(Base_Float<T, void> &a, const Base_Float<T, void> &b) noexcept {
-    a.get_raw() %= b.get_raw();
+    a.set(std::fmod(a.get(), b.get()));
     return a;
 }
 
@@ -144,8 +147,8 @@ inline Base_Float<T> &operator%=(Base_Float<T, void> &a, const Base_Float<T, voi
  * @return reference to a
  */
 template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
-inline Host_Float<T> &operator++(Base_Float<T, void> &a) noexcept {
-    ++a.get_raw();
+inline Base_Float<T> &operator++(Base_Float<T, void> &a) noexcept {
+    a.set(a.get() + T(1));
     return a;
 }
 
@@ -158,7 +161,7 @@ inline Host_Float<T> &operator++(Base_Float<T, void> &a) noexcept {
 template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
 inline Host_Float<T> operator++(Base_Float<T, void> &a, int) noexcept {  // NOLINT
     Host_Float<T> ret(a);
-    --a.get_raw();
+    a.set(a.get() + T(1));
     return ret;
 }
 
@@ -169,8 +172,8 @@ inline Host_Float<T> operator++(Base_Float<T, void> &a, int) noexcept {  // NOLI
  * @return reference to a
  */
 template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
-inline Host_Float<T> &operator--(Base_Float<T, void> &a) noexcept {
-    --a.get_raw();
+inline Base_Float<T> &operator--(Base_Float<T, void> &a) noexcept {
+    a.set(a.get() - T(1));
     return a;
 }
 
@@ -183,7 +186,7 @@ inline Host_Float<T> &operator--(Base_Float<T, void> &a) noexcept {
 template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
 inline Host_Float<T> operator--(Base_Float<T, void> &a, int) noexcept {  // NOLINT
     Host_Float<T> ret(a);
-    --a.get_raw();
+    a.set(a.get() - T(1));
     return ret;
 }
 
@@ -206,7 +209,11 @@ inline Host_Float<T> operator+(const Base_Float<T, void> &a) noexcept {
  */
 template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
 inline Host_Float<T> operator-(const Base_Float<T, void> &a) noexcept {
-    return Host_Float<T>(-a.get_raw());
+    // flip the sign bit of the bit pattern (bit exact for NaN payloads, like the negation of the value)
+    using Raw = typename Base_Float<T>::Raw;
+    Host_Float<T> ret(a);
+    ret.set_bits(static_cast<Raw>(a.get_bits() ^ (Raw(1) << (8 * sizeof(T) - 1))));
+    return ret;
 }
 
 /**
@@ -218,7 +225,15 @@ inline Host_Float<T> operator-(const Base_Float<T, void> &a) noexcept {
  */
 template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
 inline bool operator==(const Base_Float<T, void> &a, const Base_Float<T, void> &b) noexcept {
-    return a.get_raw() == b.get_raw();
+#if defined(__GNUC__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wfloat-equal"
+#endif
+    // IEEE comparison of the values is intended
+    return a.get() == b.get();
+#if defined(__GNUC__)
+#    pragma GCC diagnostic pop
+#endif
 }
 
 /**
@@ -230,7 +245,15 @@ inline bool operator==(const Base_Float<T, void> &a, const Base_Float<T, void> &
  */
 template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
 inline bool operator!=(const Base_Float<T, void> &a, const Base_Float<T, void> &b) noexcept {
-    return a.get_raw() != b.get_raw();
+#if defined(__GNUC__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wfloat-equal"
+#endif
+    // IEEE comparison of the values is intended
+    return a.get() != b.get();
+#if defined(__GNUC__)
+#    pragma GCC diagnostic pop
+#endif
 }
 
 /**
@@ -242,7 +265,7 @@ inline bool operator!=(const Base_Float<T, void> &a, const Base_Float<T, void> &
  */
 template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
 inline bool operator>(const Base_Float<T, void> &a, const Base_Float<T, void> &b) noexcept {
-    return a.get_raw() > b.get_raw();
+    return a.get() > b.get();
 }
 
 /**
@@ -254,7 +277,7 @@ inline bool operator>(const Base_Float<T, void> &a, const Base_Float<T, void> &b
  */
 template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
 inline bool operator<(const Base_Float<T, void> &a, const Base_Float<T, void> &b) noexcept {
-    return a.get_raw() < b.get_raw();
+    return a.get() < b.get();
 }
 
 /**
@@ -266,7 +289,7 @@ inline bool operator<(const Base_Float<T, void> &a, const Base_Float<T, void> &b
  */
 template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
 inline bool operator>=(const Base_Float<T, void> &a, const Base_Float<T, void> &b) noexcept {
-    return a.get_raw() >= b.get_raw();
+    return a.get() >= b.get();
 }
 
 /**
@@ -278,19 +301,26 @@ inline bool operator>=(const Base_Float<T, void> &a, const Base_Float<T, void> &
  */
 template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
 inline bool operator<=(const Base_Float<T, void> &a, const Base_Float<T, void> &b) noexcept {
-    return a.get_raw() <= b.get_raw();
+    return a.get() <= b.get();
 }
 
 /**
  * @brief output data to output stream
+ * @details only declares the stream types, include <ostream> to use this operator
+ * @tparam CharT character type of the stream
+ * @tparam Traits character traits of the stream
  * @tparam T base data type
  * @param o output stream
  * @param f instance to output
  * @return output stream
  */
-template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
-inline std::ostream &operator<<(std::ostream &o, const Base_Float<T, void> &f) {
-    o << f.get_raw();
+template <typename CharT,
+          typename Traits,
+          typename T,
+          typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
+inline std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &o,
+                                                     const Base_Float<T, void> &f) {
+    o << f.get();
     return o;
 }
 
@@ -0,0 +1,373 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <type_traits>
+
+#include "bulk.hpp"
+#include "float.hpp"
+#include "int.hpp"
+#include "packed.hpp"
+
+#if defined(CXXENDIAN_FMT)
+#    include <fmt/format.h>
+#endif
+
+#if __has_include(<version>)
+#    include <version>
+#endif
+#if defined(__cpp_lib_format)
+#    include <format>
+#endif
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace endian {
+
+//* number of bytes per line of hexdump
+constexpr std::size_t HEXDUMP_LINE = 16;
+
+/**
+ * @brief field boundaries that are marked in a hexdump
+ * @details
+ * Example (all records of a Record_Codec):
+ * @code
+ * const endian::Field_Boundaries fields {Sample::offsets, std::size(Sample::offsets), Sample::size};
+ * @endcode
+ */
+struct Field_Boundaries {
+    //* byte offsets at which a field begins (any order)
+    const std::size_t *offsets = nullptr;
+    //* number of offsets
+    std::size_t count = 0;
+    //* record size: the offsets repeat every stride bytes (0: offsets within the whole buffer)
+    std::size_t stride = 0;
+};
+
+/**
+ * @brief size of the output of hexdump
+ * @param size number of input bytes
+ * @return number of characters
+ */
+constexpr std::size_t hexdump_size(std::size_t size) noexcept {
+    return (size + HEXDUMP_LINE - 1) / HEXDUMP_LINE * 10 + 3 * size;
+}
+
+namespace detail {
+
+constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+inline void hex_scalar(const std::uint8_t *src, std::size_t n, char *dst) noexcept {
+    for (std::size_t i = 0; i < n; ++i) {
+        dst[2 * i]     = HEX_DIGITS[src[i] >> 4];
+        dst[2 * i + 1] = HEX_DIGITS[src[i] & 0xF];
+    }
+}
+
+#if defined(CXXENDIAN_HAVE_SSE2)
+//* hex digits of the upper (hi) and lower (lo) nibbles of 16 bytes
+inline void hex_digits(__m128i v, __m128i &hi, __m128i &lo) noexcept {
+    const __m128i nibble = _mm_set1_epi8(0xF);
+    const auto    digits = [](__m128i n) {
+        // '0' + n, plus the distance from '9' + 1 to 'a' for n > 9
+        const __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(n, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '0' - 10));
+        return _mm_add_epi8(_mm_add_epi8(n, _mm_set1_epi8('0')), letter);
+    };
+    hi = digits(_mm_and_si128(_mm_srli_epi16(v, 4), nibble));
+    lo = digits(_mm_and_si128(v, nibble));
+}
+#endif
+
+#if defined(CXXENDIAN_HAVE_SSSE3)
+/**
+ * @brief byte shuffle mask of a hexdump line
+ * @details
+ * The 48 characters of a line are 16 triples (separator, upper digit, lower digit). Output vector k takes its bytes
+ * from the separators (source 0), the digit pairs of bytes 0..7 (source 1) or the digit pairs of bytes 8..15
+ * (source 2); all other bytes of the mask are zeroing indices.
+ */
+inline __m128i line_mask(std::size_t k, std::size_t source) noexcept {
+    alignas(16) std::uint8_t m[16];
+    for (std::size_t q = 0; q < 16; ++q) {
+        const std::size_t p = 16 * k + q;
+        const std::size_t j = p / 3;
+        std::size_t       from;
+        std::size_t       index;
+        if (p % 3 == 0) {
+            from  = 0;
+            index = j;
+        } else {
+            const std::size_t t = 2 * j + p % 3 - 1;
+            from                = 1 + t / 16;
+            index               = t % 16;
+        }
+        m[q] = from == source ? static_cast<std::uint8_t>(index) : std::uint8_t(0x80);
+    }
+    return _mm_load_si128(reinterpret_cast<const __m128i *>(m));
+}
+
+//* separator characters of a line: '|' where the bit of the byte in mask is set, ' ' otherwise
+inline __m128i line_separators(std::uint32_t mask) noexcept {
+    const __m128i bit = _mm_set1_epi64x(static_cast<long long>(0x8040201008040201ULL));
+    __m128i       v   = _mm_set1_epi16(static_cast<short>(mask));
+    v                 = _mm_shuffle_epi8(v, _mm_set_epi64x(0x0101010101010101LL, 0));
+    v                 = _mm_cmpeq_epi8(_mm_and_si128(v, bit), bit);
+    return _mm_or_si128(_mm_set1_epi8(' '), _mm_and_si128(v, _mm_set1_epi8('|' ^ ' ')));
+}
+#endif
+
+//* bit i set if a field begins at byte begin + i (i < HEXDUMP_LINE)
+inline std::uint32_t line_boundaries(const Field_Boundaries &fields, std::size_t begin) noexcept {
+    const std::size_t end  = begin + HEXDUMP_LINE;
+    std::uint32_t     mask = 0;
+    for (std::size_t f = 0; f < fields.count; ++f) {
+        const std::size_t offset = fields.offsets[f];
+        if (fields.stride == 0) {
+            if (offset >= begin && offset < end) mask |= std::uint32_t(1) << (offset - begin);
+            continue;
+        }
+        // first position >= begin that is congruent to the offset
+        const std::size_t o = offset % fields.stride;
+        const std::size_t r = begin % fields.stride;
+        for (std::size_t p = begin + (o + fields.stride - r) % fields.stride; p < end; p += fields.stride)
+            mask |= std::uint32_t(1) << (p - begin);
+    }
+    return mask;
+}
+
+}  // namespace detail
+
+/**
+ * @brief convert bytes to hexadecimal characters (lower case, 2 characters per byte, no separators)
+ * @param src input (no alignment required)
+ * @param n number of bytes
+ * @param dst output (2 * n characters, not null terminated)
+ */
+inline void hex_n(const void *src, std::size_t n, char *dst) noexcept {
+    const auto *s = static_cast<const std::uint8_t *>(src);
+    std::size_t i = 0;
+#if defined(CXXENDIAN_HAVE_SSE2)
+    for (; i + 16 <= n; i += 16) {
+        __m128i hi, lo;
+        detail::hex_digits(_mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i)), hi, lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 2 * i), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+#endif
+    detail::hex_scalar(s + i, n - i, dst + 2 * i);
+}
+
+/**
+ * @brief hexdump of a wire buffer with marked field boundaries
+ * @details
+ * One line per 16 bytes: the offset of the line (8 hexadecimal digits, lower 32 bits), a space and per byte a
+ * separator followed by 2 hexadecimal digits. The separator is '|' if a field begins at the byte, ' ' otherwise.
+ * Every line ends with '\\n'. No memory is allocated; the output is written with 3 vector stores per full line.
+ *
+ * Example (records of 6 bytes with fields at offset 0, 2 and 4):
+ * @code
+ * 00000000 |00 01|00 00|12 34|00 02|00 00|56 78|00 03|00 00
+ * 00000010 |9a bc|00 04
+ * @endcode
+ *
+ * @param src input (no alignment required)
+ * @param size number of bytes
+ * @param dst output (at least hexdump_size(size) characters, not null terminated)
+ * @param fields field boundaries to mark
+ * @return number of characters written (hexdump_size(size))
+ */
+inline std::size_t hexdump(const void *src, std::size_t size, char *dst, const Field_Boundaries &fields = {}) noexcept {
+    const auto *s = static_cast<const std::uint8_t *>(src);
+    char       *d = dst;
+
+#if defined(CXXENDIAN_HAVE_SSSE3)
+    const __m128i sep0 = detail::line_mask(0, 0), lo0 = detail::line_mask(0, 1);
+    const __m128i sep1 = detail::line_mask(1, 0), lo1 = detail::line_mask(1, 1), hi1 = detail::line_mask(1, 2);
+    const __m128i sep2 = detail::line_mask(2, 0), hi2 = detail::line_mask(2, 2);
+#endif
+
+    for (std::size_t line = 0; line < size; line += HEXDUMP_LINE) {
+        const std::size_t   m    = std::min(HEXDUMP_LINE, size - line);
+        const std::uint32_t mask = detail::line_boundaries(fields, line);
+
+        const std::uint32_t offset = static_cast<std::uint32_t>(line);
+        for (unsigned i = 0; i < 8; ++i)
+            d[i] = detail::HEX_DIGITS[(offset >> (28 - 4 * i)) & 0xF];
+        d[8] = ' ';
+        d += 9;
+
+#if defined(CXXENDIAN_HAVE_SSSE3)
+        if (m == HEXDUMP_LINE) {
+            __m128i hi, lo;
+            detail::hex_digits(_mm_loadu_si128(reinterpret_cast<const __m128i *>(s + line)), hi, lo);
+            const __m128i pairs0 = _mm_unpacklo_epi8(hi, lo);
+            const __m128i pairs1 = _mm_unpackhi_epi8(hi, lo);
+            const __m128i sep    = detail::line_separators(mask);
+
+            const __m128i digits1 = _mm_or_si128(_mm_shuffle_epi8(pairs0, lo1), _mm_shuffle_epi8(pairs1, hi1));
+            const __m128i out0    = _mm_or_si128(_mm_shuffle_epi8(sep, sep0), _mm_shuffle_epi8(pairs0, lo0));
+            const __m128i out1    = _mm_or_si128(_mm_shuffle_epi8(sep, sep1), digits1);
+            const __m128i out2    = _mm_or_si128(_mm_shuffle_epi8(sep, sep2), _mm_shuffle_epi8(pairs1, hi2));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(d), out0);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(d + 16), out1);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(d + 32), out2);
+            d += 48;
+            *d++ = '\n';
+            continue;
+        }
+#endif
+
+        for (std::size_t i = 0; i < m; ++i) {
+            d[0] = (mask >> i) & 1 ? '|' : ' ';
+            d[1] = detail::HEX_DIGITS[s[line + i] >> 4];
+            d[2] = detail::HEX_DIGITS[s[line + i] & 0xF];
+            d += 3;
+        }
+        *d++ = '\n';
+    }
+    return static_cast<std::size_t>(d - dst);
+}
+
+}  // namespace endian
+
+namespace cxxendian {
+
+/**
+ * @brief convert the value (not the stored byte pattern) to characters
+ * @details same as std::to_chars for the value in host endian (no allocation, no locale)
+ * @tparam T base data type
+ * @param first begin of the output
+ * @param last end of the output
+ * @param v value
+ * @param base base of the number (2 to 36)
+ * @return see std::to_chars
+ */
+template <typename T>
+inline std::to_chars_result to_chars(char *first, char *last, const Base_Int<T, void> &v, int base = 10) noexcept {
+    return std::to_chars(first, last, v.get(), base);
+}
+
+/**
+ * @brief convert the value (not the stored byte pattern) to characters
+ * @details
+ * Shortest representation that is read back to the same value (std::to_chars). Standard libraries without floating
+ * point std::to_chars use snprintf with max_digits10 significant digits.
+ * @tparam T base data type
+ * @param first begin of the output
+ * @param last end of the output
+ * @param v value
+ * @return see std::to_chars
+ */
+template <typename T>
+inline std::to_chars_result to_chars(char *first, char *last, const Base_Float<T, void> &v) noexcept {
+#if defined(__cpp_lib_to_chars)
+    return std::to_chars(first, last, v.get());
+#else
+    const auto size = static_cast<std::size_t>(last - first);
+    const int  n    = std::snprintf(first,
+                                size,
+                                "%.*g",
+                                std::numeric_limits<T>::max_digits10,
+                                static_cast<double>(v.get()));
+    if (n < 0 || static_cast<std::size_t>(n) >= size) return {last, std::errc::value_too_large};
+    return {first + n, std::errc()};
+#endif
+}
+
+/**
+ * @brief convert the value of a packed integer to characters
+ * @details see to_chars(char *, char *, const Base_Int<T> &, int)
+ */
+template <typename T, endian::Order order, typename = std::enable_if_t<std::is_integral<T>::value>>
+inline std::to_chars_result to_chars(char *first, char *last, const Packed<T, order> &v, int base = 10) noexcept {
+    return std::to_chars(first, last, v.get(), base);
+}
+
+/**
+ * @brief convert the value of a packed floating point number to characters
+ * @details see to_chars(char *, char *, const Base_Float<T> &)
+ */
+template <typename T, endian::Order order, typename = std::enable_if_t<std::is_floating_point<T>::value>>
+inline std::to_chars_result to_chars(char *first, char *last, const Packed<T, order> &v) noexcept {
+    return to_chars(first, last, Host_Float<T>(v.get()));
+}
+
+/**
+ * @brief hexadecimal representation of the value with all digits (2 per byte, most significant first)
+ * @details
+ * Negative values are represented in two's complement, floating point values by their bit pattern
+ * (e.g. BE_Int<int16_t>(-2): "fffe", LE_Float<float>(1.0f): "3f800000"). The representation does not depend on the
+ * byte order of the type.
+ * @tparam Type LE_*, BE_*, Host_* or Packed type
+ * @param first begin of the output
+ * @param last end of the output
+ * @param v value
+ * @return see std::to_chars
+ */
+template <typename Type>
+inline std::to_chars_result to_chars_hex(char *first, char *last, const Type &v) noexcept {
+    const auto value = v.get();
+    if (static_cast<std::size_t>(last - first) < 2 * sizeof(value)) return {last, std::errc::value_too_large};
+    const Packed<decltype(value), endian::Order::Big> big(value);
+    endian::hex_n(big.data(), sizeof(value), first);
+    return {first + 2 * sizeof(value), std::errc()};
+}
+
+}  // namespace cxxendian
+
+// formatters: format the value with the format specification of the base data type (e.g. "{:#06x}")
+// clang-format off
+#define CXXENDIAN_VALUE_FORMATTER(TYPE)                                                                                \
+    template <typename T, typename Char>                                                                               \
+    struct formatter<TYPE, Char> : formatter<T, Char> {                                                                \
+        template <typename FormatContext>                                                                              \
+        auto format(const TYPE &v, FormatContext &ctx) const -> decltype(ctx.out()) {                                  \
+            return formatter<T, Char>::format(v.get(), ctx);                                                           \
+        }                                                                                                              \
+    };
+
+#define CXXENDIAN_VALUE_FORMATTERS                                                                                     \
+    CXXENDIAN_VALUE_FORMATTER(cxxendian::Base_Int<T CXXENDIAN_COMMA void>)                                             \
+    CXXENDIAN_VALUE_FORMATTER(cxxendian::LE_Int<T>)                                                                    \
+    CXXENDIAN_VALUE_FORMATTER(cxxendian::BE_Int<T>)                                                                    \
+    CXXENDIAN_VALUE_FORMATTER(cxxendian::Host_Int<T>)                                                                  \
+    CXXENDIAN_VALUE_FORMATTER(cxxendian::Base_Float<T CXXENDIAN_COMMA void>)                                           \
+    CXXENDIAN_VALUE_FORMATTER(cxxendian::LE_Float<T>)                                                                  \
+    CXXENDIAN_VALUE_FORMATTER(cxxendian::BE_Float<T>)                                                                  \
+    CXXENDIAN_VALUE_FORMATTER(cxxendian::Host_Float<T>)                                                                \
+    template <typename T, endian::Order order, typename Char>                                                          \
+    struct formatter<cxxendian::Packed<T, order>, Char> : formatter<T, Char> {                                         \
+        template <typename FormatContext>                                                                              \
+        auto format(const cxxendian::Packed<T, order> &v, FormatContext &ctx) const -> decltype(ctx.out()) {           \
+            return formatter<T, Char>::format(v.get(), ctx);                                                           \
+        }                                                                                                              \
+    };
+// clang-format on
+#define CXXENDIAN_COMMA ,
+
+#if defined(__cpp_lib_format)
+namespace std {
+CXXENDIAN_VALUE_FORMATTERS
+}  // namespace std
+#endif
+
+// fmt: define CXXENDIAN_FMT or include <fmt/format.h> before this header
+#if defined(FMT_VERSION)
+namespace fmt {
+CXXENDIAN_VALUE_FORMATTERS
+}  // namespace fmt
+#endif
+
+#undef CXXENDIAN_VALUE_FORMATTERS
+#undef CXXENDIAN_VALUE_FORMATTER
+#undef CXXENDIAN_COMMA
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+/*
+ * Forward declarations of all types of the library.
+ * Include this header instead of cxxendian.hpp in headers that only need to name the types (function declarations,
+ * pointers and references, struct members of pointer type).
+ */
+
+#include <type_traits>
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace endian {
+
+enum class Order;
+
+}  // namespace endian
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace cxxendian {
+
+template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
+class Base_Int;
+
+template <typename T>
+class LE_Int;
+
+template <typename T>
+class BE_Int;
+
+template <typename T>
+class Host_Int;
+
+template <typename T, typename = typename std::enable_if_t<std::is_floating_point<T>::value>>
+class Base_Float;
+
+template <typename T>
+class LE_Float;
+
+template <typename T>
+class BE_Float;
+
+template <typename T>
+class Host_Float;
+
+template <typename T, endian::Order order>
+class Packed;
+
+template <typename T>
+struct Endian_Traits;
+
+}  // namespace cxxendian
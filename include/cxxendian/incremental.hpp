@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <utility>
+
+#include "bulk.hpp"
+#include "columnar.hpp"
+#include "traits.hpp"
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace cxxendian {
+
+namespace detail {
+
+/**
+ * @brief splits a byte stream that arrives in arbitrary chunks into complete elements of ELEMENT bytes
+ * @details Complete elements are passed to decode(const uint8_t *src, size_t n) in runs of at most BLOCK elements.
+ * An incomplete element at the end of a chunk is kept and completed by the next chunk.
+ */
+template <std::size_t ELEMENT, std::size_t BLOCK>
+class Element_Splitter {
+    std::uint8_t carry[ELEMENT];
+    std::size_t  carried = 0;
+
+public:
+    template <typename Decode>
+    void feed(const void *data, std::size_t bytes, Decode &&decode) {
+        const auto *p = static_cast<const std::uint8_t *>(data);
+
+        // complete the element of the previous chunk
+        if (carried) {
+            const std::size_t k = std::min(ELEMENT - carried, bytes);
+            std::memcpy(carry + carried, p, k);
+            carried += k;
+            p += k;
+            bytes -= k;
+            if (carried < ELEMENT) return;
+            carried = 0;
+            decode(static_cast<const std::uint8_t *>(carry), std::size_t(1));
+        }
+
+        // complete elements directly from the chunk
+        while (bytes >= ELEMENT) {
+            const std::size_t n = std::min(bytes / ELEMENT, BLOCK);
+            decode(p, n);
+            p += n * ELEMENT;
+            bytes -= n * ELEMENT;
+        }
+
+        // keep the incomplete element
+        if (bytes) std::memcpy(carry, p, bytes);
+        carried = bytes;
+    }
+
+    std::size_t pending() const noexcept { return carried; }
+
+    void reset() noexcept { carried = 0; }
+};
+
+}  // namespace detail
+
+/**
+ * @brief resumable decoder for a stream of values that arrives in arbitrary fragments (e.g. from a TCP socket)
+ * @details
+ * Every call of feed emits all values that are complete so far. Runs of complete values are converted with the
+ * bulk kernels into a small internal buffer of BLOCK values and passed to the callback. A value that is split
+ * between two fragments is carried over to the next call. No fragment needs to be buffered.
+ *
+ * Example:
+ * @code
+ * cxxendian::Incremental_Decoder<cxxendian::BE_Int<int16_t>> decoder;
+ * while ((n = recv(fd, buf, sizeof(buf), 0)) > 0)
+ *     decoder.feed(buf, n, [&](const int16_t *samples, size_t count) { process(samples, count); });
+ * @endcode
+ *
+ * @tparam Type endian type of the values (e.g. BE_Int<uint32_t>, LE_Float<float>, Packed_BE_Int<uint16_t>)
+ * @tparam BLOCK maximum number of values per callback
+ */
+template <typename Type, std::size_t BLOCK = 256>
+class Incremental_Decoder {
+public:
+    //* base data type of the emitted values
+    using value_type = typename Endian_Traits<Type>::value_type;
+    //* byte order of the stream
+    static constexpr endian::Order order = Endian_Traits<Type>::order;
+
+private:
+    detail::Element_Splitter<sizeof(value_type), BLOCK> splitter;
+    value_type                                          out[BLOCK];
+
+public:
+    /**
+     * @brief consume a fragment of the stream
+     * @tparam F callable f(const value_type *values, std::size_t n)
+     * @param data fragment
+     * @param bytes size of the fragment in bytes
+     * @param emit called for every run of complete values (values are valid during the call only)
+     */
+    template <typename F>
+    void feed(const void *data, std::size_t bytes, F &&emit) {
+        CXXENDIAN_COUNT_BULK(endian::detail::to_host_direction(order),
+                             sizeof(value_type),
+                             (splitter.pending() + bytes) / sizeof(value_type));
+        splitter.feed(data, bytes, [&](const std::uint8_t *src, std::size_t n) {
+            endian::detail::convert_bytes<order, sizeof(value_type)>(src, out, n);
+            emit(static_cast<const value_type *>(out), n);
+        });
+    }
+
+    //* number of bytes of an incomplete value that are carried over to the next fragment
+    std::size_t pending() const noexcept { return splitter.pending(); }
+
+    //* discard an incomplete value (e.g. after the connection was reset)
+    void reset() noexcept { splitter.reset(); }
+};
+
+/**
+ * @brief resumable decoder for a stream of wire format records that arrives in arbitrary fragments
+ * @details
+ * Same as Incremental_Decoder, but for densely packed records that are described by Field types (see
+ * Record_Codec). Complete records are decoded into one host endian column per field and passed to the callback.
+ *
+ * Example:
+ * @code
+ * cxxendian::Incremental_Record_Decoder<cxxendian::Field<cxxendian::BE_Int<uint32_t>, 0>,
+ *                                       cxxendian::Field<cxxendian::BE_Float<float>, 4>> decoder;
+ * decoder.feed(buf, n, [&](size_t count, const uint32_t *ids, const float *values) { ... });
+ * @endcode
+ *
+ * @tparam Fields record fields (Field<Type, Offset>)
+ */
+template <typename... Fields>
+class Incremental_Record_Decoder {
+public:
+    //* codec of the records
+    using Codec = Record_Codec<Fields...>;
+
+    //* maximum number of records per callback
+    static constexpr std::size_t BLOCK = std::max<std::size_t>(1, 4096 / Codec::size);
+
+private:
+    detail::Element_Splitter<Codec::size, BLOCK>                  splitter;
+    std::tuple<std::array<typename Fields::value_type, BLOCK>...> columns;
+
+    template <typename F, std::size_t... I>
+    void decode(const std::uint8_t *src, std::size_t n, F &emit, std::index_sequence<I...>) {
+        Codec::decode_blocks(src, Codec::size, n, std::get<I>(columns).data()...);
+        emit(n, static_cast<const typename Fields::value_type *>(std::get<I>(columns).data())...);
+    }
+
+public:
+    /**
+     * @brief consume a fragment of the stream
+     * @tparam F callable f(std::size_t n, const value_type *column...) (one column per field, same order as Fields)
+     * @param data fragment
+     * @param bytes size of the fragment in bytes
+     * @param emit called for every run of complete records (columns are valid during the call only)
+     */
+    template <typename F>
+    void feed(const void *data, std::size_t bytes, F &&emit) {
+        Codec::count_decode((splitter.pending() + bytes) / Codec::size);
+        splitter.feed(data, bytes, [&](const std::uint8_t *src, std::size_t n) {
+            decode(src, n, emit, std::index_sequence_for<Fields...>());
+        });
+    }
+
+    //* number of bytes of an incomplete record that are carried over to the next fragment
+    std::size_t pending() const noexcept { return splitter.pending(); }
+
+    //* discard an incomplete record (e.g. after the connection was reset)
+    void reset() noexcept { splitter.reset(); }
+};
+
+}  // namespace cxxendian
@@ -0,0 +1,349 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(CXXENDIAN_INSTRUMENT)
+#    include <algorithm>
+#    include <atomic>
+#    include <mutex>
+#    include <vector>
+#endif
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace endian {
+
+/**
+ * @brief conversion counters (opt-in)
+ * @details
+ * The counters are only compiled in if CXXENDIAN_INSTRUMENT is defined (for all translation units, e.g. via
+ * target_compile_definitions). Otherwise all hooks expand to nothing and the functions in this namespace report no
+ * data.
+ *
+ * Counted are
+ *  - scalar conversions: host_to_big, host_to_little, big_to_host, little_to_host, big_to_little, little_to_big
+ *    (and their short aliases). swap itself is not counted.
+ *  - bulk conversions: one call and n conversions per call of a public bulk function
+ *
+ * Every thread counts into its own counters. for_each aggregates the counters of all threads on demand.
+ *
+ * Conversions can additionally be attributed to a named call site:
+ * @code
+ * void parse_frame(const uint8_t *buf, size_t n, float *out) {
+ *     CXXENDIAN_INSTRUMENT_SITE("parse_frame");
+ *     endian::to_host_convert_n<endian::Order::Big, int16_t>(buf, out, n / 2, 1.f, 0.f);
+ * }
+ * @endcode
+ */
+namespace instrument {
+
+//* true if the library was compiled with CXXENDIAN_INSTRUMENT
+#if defined(CXXENDIAN_INSTRUMENT)
+constexpr bool enabled = true;
+#else
+constexpr bool enabled = false;
+#endif
+
+/**
+ * @brief direction of a conversion
+ */
+enum class Direction : unsigned { Swap, Host_To_Big, Host_To_Little, Big_To_Host, Little_To_Host };
+
+//* number of directions
+constexpr std::size_t DIRECTIONS = 5;
+
+//* number of counted element widths (1, 2, 4, 8, 16 bytes)
+constexpr std::size_t WIDTHS = 5;
+
+/**
+ * @brief name of a direction
+ * @param d direction
+ * @return name (e.g. "host_to_big")
+ */
+constexpr const char *to_string(Direction d) noexcept {
+    // same order as Direction
+    constexpr const char *names[DIRECTIONS] = {
+            "swap", "host_to_big", "host_to_little", "big_to_host", "little_to_host"};
+    const auto index = static_cast<std::size_t>(d);
+    return index < DIRECTIONS ? names[index] : "unknown";
+}
+
+/**
+ * @brief aggregated counter value (see for_each)
+ */
+struct Record {
+    //* name of the call site or nullptr for the global counters
+    const char *site;
+    //* direction
+    Direction direction;
+    //* element width in bytes
+    std::size_t width;
+    //* number of converted elements
+    std::uint64_t conversions;
+    //* number of converted bytes
+    std::uint64_t bytes;
+    //* number of bulk calls (0 for scalar conversions)
+    std::uint64_t bulk_calls;
+};
+
+#if defined(CXXENDIAN_INSTRUMENT)
+
+namespace detail {
+
+struct Counter {
+    std::atomic<std::uint64_t> conversions {0};
+    std::atomic<std::uint64_t> bytes {0};
+    std::atomic<std::uint64_t> bulk_calls {0};
+};
+
+struct Table {
+    Counter c[DIRECTIONS][WIDTHS];
+};
+
+constexpr std::size_t width_index(std::size_t width) noexcept {
+    return width <= 1 ? 0 : width <= 2 ? 1 : width <= 4 ? 2 : width <= 8 ? 3 : 4;
+}
+
+/**
+ * @brief counters of a named call site (shared by all threads)
+ */
+struct Site_Table {
+    const char *name;
+    Table       table;
+};
+
+/**
+ * @brief all counter tables of the process
+ */
+struct Registry {
+    std::mutex                 mutex;
+    std::vector<const Table *> threads;
+    std::vector<Site_Table *>  sites;
+    Table                      retired;  // counters of threads that have already finished
+
+    static Registry &get() {
+        static auto *registry = new Registry();  // never destroyed: threads may finish after static destruction
+        return *registry;
+    }
+};
+
+inline void add(Counter &dst, std::uint64_t conversions, std::uint64_t bytes, std::uint64_t calls) noexcept {
+    dst.conversions.fetch_add(conversions, std::memory_order_relaxed);
+    dst.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    dst.bulk_calls.fetch_add(calls, std::memory_order_relaxed);
+}
+
+/**
+ * @brief counters of the current thread
+ */
+struct Thread_Table {
+    Table table;
+
+    Thread_Table() {
+        auto                       &r = Registry::get();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.threads.push_back(&table);
+    }
+
+    ~Thread_Table() {
+        auto                       &r = Registry::get();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        for (std::size_t d = 0; d < DIRECTIONS; ++d) {
+            for (std::size_t w = 0; w < WIDTHS; ++w) {
+                const Counter &c = table.c[d][w];
+                add(r.retired.c[d][w],
+                    c.conversions.load(std::memory_order_relaxed),
+                    c.bytes.load(std::memory_order_relaxed),
+                    c.bulk_calls.load(std::memory_order_relaxed));
+            }
+        }
+        r.threads.erase(std::find(r.threads.begin(), r.threads.end(), &table));
+    }
+
+    Thread_Table(const Thread_Table &)            = delete;
+    Thread_Table &operator=(const Thread_Table &) = delete;
+};
+
+inline Table &thread_table() {
+    thread_local Thread_Table t;
+    return t.table;
+}
+
+//* call site of the current thread (set by CXXENDIAN_INSTRUMENT_SITE)
+inline thread_local Site_Table *current_site = nullptr;
+
+/**
+ * @brief count a conversion
+ * @param direction direction
+ * @param width element size in bytes
+ * @param n number of elements
+ * @param bulk true for bulk calls
+ */
+inline void count(Direction direction, std::size_t width, std::uint64_t n, bool bulk) noexcept {
+    const auto d = static_cast<std::size_t>(direction);
+    const auto w = width_index(width);
+
+    // single writer: no read-modify-write instruction required
+    Counter &c = thread_table().c[d][w];
+    c.conversions.store(c.conversions.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    c.bytes.store(c.bytes.load(std::memory_order_relaxed) + n * width, std::memory_order_relaxed);
+    if (bulk) c.bulk_calls.store(c.bulk_calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    if (current_site) add(current_site->table.c[d][w], n, n * width, bulk ? 1 : 0);
+}
+
+}  // namespace detail
+
+/**
+ * @brief named call site (use CXXENDIAN_INSTRUMENT_SITE)
+ */
+class Site {
+    detail::Site_Table site;
+
+public:
+    /**
+     * @brief register call site
+     * @param name name of the call site (must be a string with static storage duration)
+     */
+    explicit Site(const char *name) : site {name, {}} {
+        auto                       &r = detail::Registry::get();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.sites.push_back(&site);
+    }
+
+    Site(const Site &)            = delete;
+    Site &operator=(const Site &) = delete;
+
+    ~Site() {
+        auto                       &r = detail::Registry::get();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.sites.erase(std::find(r.sites.begin(), r.sites.end(), &site));
+    }
+
+    //* counters of this site
+    detail::Site_Table *get() noexcept { return &site; }
+};
+
+/**
+ * @brief attributes all conversions of the current thread to a call site while in scope
+ */
+class Site_Scope {
+    detail::Site_Table *previous;
+
+public:
+    /**
+     * @brief enter call site
+     * @param s call site
+     */
+    explicit Site_Scope(Site &s) noexcept : previous(detail::current_site) { detail::current_site = s.get(); }
+
+    Site_Scope(const Site_Scope &)            = delete;
+    Site_Scope &operator=(const Site_Scope &) = delete;
+
+    //* leave call site
+    ~Site_Scope() { detail::current_site = previous; }
+};
+
+/**
+ * @brief call f(const Record &) for every counter that is not zero
+ * @details The global counters (site == nullptr) are the sum of all threads. The site counters follow.
+ * @tparam F callable
+ * @param f callback
+ */
+template <typename F>
+inline void for_each(F &&f) {
+    auto                       &r = detail::Registry::get();
+    std::lock_guard<std::mutex> lock(r.mutex);
+
+    auto emit = [&f](const char *site, const detail::Table *const *tables, std::size_t n_tables) {
+        for (std::size_t d = 0; d < DIRECTIONS; ++d) {
+            for (std::size_t w = 0; w < WIDTHS; ++w) {
+                Record rec {site, static_cast<Direction>(d), std::size_t(1) << w, 0, 0, 0};
+                for (std::size_t t = 0; t < n_tables; ++t) {
+                    const detail::Counter &c = tables[t]->c[d][w];
+                    rec.conversions += c.conversions.load(std::memory_order_relaxed);
+                    rec.bytes += c.bytes.load(std::memory_order_relaxed);
+                    rec.bulk_calls += c.bulk_calls.load(std::memory_order_relaxed);
+                }
+                if (rec.conversions || rec.bulk_calls) f(static_cast<const Record &>(rec));
+            }
+        }
+    };
+
+    std::vector<const detail::Table *> tables(r.threads);
+    tables.push_back(&r.retired);
+    emit(nullptr, tables.data(), tables.size());
+
+    for (const auto *site : r.sites) {
+        const detail::Table *table = &site->table;
+        emit(site->name, &table, 1);
+    }
+}
+
+/**
+ * @brief reset all counters
+ * @details Counters that are modified concurrently by other threads may lose the modification.
+ */
+inline void reset() {
+    auto                       &r = detail::Registry::get();
+    std::lock_guard<std::mutex> lock(r.mutex);
+
+    auto clear = [](detail::Table &t) {
+        for (auto &row : t.c) {
+            for (auto &c : row) {
+                c.conversions.store(0, std::memory_order_relaxed);
+                c.bytes.store(0, std::memory_order_relaxed);
+                c.bulk_calls.store(0, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    for (const auto *t : r.threads)
+        clear(*const_cast<detail::Table *>(t));
+    clear(r.retired);
+    for (auto *site : r.sites)
+        clear(site->table);
+}
+
+#else
+
+/**
+ * @brief call f(const Record &) for every counter that is not zero
+ * @details instrumentation disabled: no records
+ */
+template <typename F>
+inline void for_each(F &&) {}
+
+/**
+ * @brief reset all counters
+ * @details instrumentation disabled: no effect
+ */
+inline void reset() {}
+
+#endif
+
+}  // namespace instrument
+
+}  // namespace endian
+
+#if defined(CXXENDIAN_INSTRUMENT)
+//* count a scalar conversion
+#    define CXXENDIAN_COUNT_SCALAR(direction, width) ::endian::instrument::detail::count(direction, width, 1, false)
+//* count a bulk conversion of n elements
+#    define CXXENDIAN_COUNT_BULK(direction, width, n) ::endian::instrument::detail::count(direction, width, n, true)
+//* attribute all conversions of the current scope to the call site name
+#    define CXXENDIAN_INSTRUMENT_SITE(name)                                                                          \
+        static ::endian::instrument::Site cxxendian_instrument_site_(name);                                         \
+        const ::endian::instrument::Site_Scope cxxendian_instrument_scope_(cxxendian_instrument_site_)
+#else
+#    define CXXENDIAN_COUNT_SCALAR(direction, width) static_cast<void>(0)
+#    define CXXENDIAN_COUNT_BULK(direction, width, n) static_cast<void>(0)
+#    define CXXENDIAN_INSTRUMENT_SITE(name) static_cast<void>(0)
+#endif
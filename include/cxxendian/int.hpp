@@ -14,12 +14,6 @@
  */
 namespace cxxendian {
 
-template <typename T>
-class LE_Int;
-
-template <typename T>
-class BE_Int;
-
 /**
  * @brief class that represents a integer value using little endian
  * @tparam T data type (floating point only)
@@ -39,7 +33,7 @@ public:
      * @param other other instance
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
-    explicit LE_Int(const Base_Int<t_other> &other) noexcept : Base_Int<T>(other.get_raw()) {}
+    explicit LE_Int(const Base_Int<t_other> &other) noexcept : Base_Int<T>(endian::host_to_little(other.get())) {}
 
     /**
      * @brief move constructor
@@ -47,7 +41,7 @@ public:
      * @param other other instance
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
-    explicit LE_Int(Base_Int<t_other> &&other) noexcept : Base_Int<T>(other.get_raw()) {}
+    explicit LE_Int(Base_Int<t_other> &&other) noexcept : Base_Int<T>(endian::host_to_little(other.get())) {}
 
     /**
      * @brief create from float type (type conversion)
@@ -55,7 +49,8 @@ public:
      * @param other other instance
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_floating_point<t_other>::value>>
-    explicit LE_Int(Base_Float<t_other> &other) noexcept : Base_Int<T>(static_cast<T>(other.get_raw())) {}
+    explicit LE_Int(const Base_Float<t_other> &other) noexcept
+            : Base_Int<T>(endian::host_to_little(static_cast<T>(other.get()))) {}
 
     /**
      * @brief assign from integer type with any endianness
@@ -65,7 +60,7 @@ public:
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
     LE_Int<T> &operator=(const Base_Int<t_other> &other) noexcept {
-        Base_Int<T>::data = other.data;
+        Base_Int<T>::data = endian::host_to_little(other.get());
         return *this;
     }
 
@@ -77,7 +72,7 @@ public:
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
     LE_Int<T> &operator=(Base_Int<t_other> &&other) noexcept {
-        Base_Int<T>::data = other.data;
+        Base_Int<T>::data = endian::host_to_little(other.get());
         return *this;
     }
 
@@ -87,7 +82,7 @@ public:
      * @return this instance
      */
     LE_Int<T> &operator=(T v) noexcept {
-        Base_Int<T>::data = v;
+        Base_Int<T>::data = endian::host_to_little(v);
         return *this;
     }
 
@@ -97,6 +92,12 @@ public:
      */
     inline T get() const noexcept override { return endian::host_to_little(Base_Int<T>::data); }
 
+    /**
+     * @brief set the value
+     * @param v value in host endian
+     */
+    inline void set(T v) noexcept override { Base_Int<T>::data = endian::host_to_little(v); }
+
     //* default destructor
     ~LE_Int() override = default;
 };
@@ -120,7 +121,7 @@ public:
      * @param other other instance
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
-    explicit BE_Int(const Base_Int<t_other> &other) noexcept : Base_Int<T>(other.get_raw()) {}
+    explicit BE_Int(const Base_Int<t_other> &other) noexcept : Base_Int<T>(endian::host_to_big(other.get())) {}
 
     /**
      * @brief move constructor
@@ -128,7 +129,7 @@ public:
      * @param other other instance
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
-    explicit BE_Int(Base_Int<t_other> &&other) noexcept : Base_Int<T>(other.get_raw()) {}
+    explicit BE_Int(Base_Int<t_other> &&other) noexcept : Base_Int<T>(endian::host_to_big(other.get())) {}
 
     /**
      * @brief create from float type (type conversion)
@@ -136,7 +137,8 @@ public:
      * @param other other instance
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_floating_point<t_other>::value>>
-    explicit BE_Int(Base_Float<t_other> &other) noexcept : Base_Int<T>(static_cast<T>(other.get_raw())) {}
+    explicit BE_Int(const Base_Float<t_other> &other) noexcept
+            : Base_Int<T>(endian::host_to_big(static_cast<T>(other.get()))) {}
 
     /**
      * @brief assign from integer type with any endianness
@@ -146,7 +148,7 @@ public:
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
     BE_Int<T> &operator=(const Base_Int<t_other> &other) noexcept {
-        Base_Int<T>::data = other.data;
+        Base_Int<T>::data = endian::host_to_big(other.get());
         return *this;
     }
 
@@ -158,7 +160,7 @@ public:
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
     BE_Int<T> &operator=(Base_Int<t_other> &&other) noexcept {
-        Base_Int<T>::data = other.data;
+        Base_Int<T>::data = endian::host_to_big(other.get());
         return *this;
     }
 
@@ -168,7 +170,7 @@ public:
      * @return this instance
      */
     BE_Int<T> &operator=(T v) noexcept {
-        Base_Int<T>::data = v;
+        Base_Int<T>::data = endian::host_to_big(v);
         return *this;
     }
 
@@ -178,6 +180,12 @@ public:
      */
     inline T get() const noexcept override { return endian::host_to_big(Base_Int<T>::data); }
 
+    /**
+     * @brief set the value
+     * @param v value in host endian
+     */
+    inline void set(T v) noexcept override { Base_Int<T>::data = endian::host_to_big(v); }
+
     //* default destructor
     ~BE_Int() override = default;
 };
@@ -202,7 +210,7 @@ public:
      * @param other other instance
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
-    explicit Host_Int(const Base_Int<t_other> &other) noexcept : Base_Int<T>(other.get_raw()) {}
+    explicit Host_Int(const Base_Int<t_other> &other) noexcept : Base_Int<T>(other.get()) {}
 
     /**
      * @brief move constructor
@@ -210,7 +218,7 @@ public:
      * @param other other instance
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
-    explicit Host_Int(Base_Int<t_other> &&other) noexcept : Base_Int<T>(other.get_raw()) {}
+    explicit Host_Int(Base_Int<t_other> &&other) noexcept : Base_Int<T>(other.get()) {}
 
     /**
      * @brief create from float type (type conversion)
@@ -218,7 +226,7 @@ public:
      * @param other other instance
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_floating_point<t_other>::value>>
-    explicit Host_Int(Base_Float<t_other> &other) noexcept : Base_Int<T>(static_cast<T>(other.get_raw())) {}
+    explicit Host_Int(const Base_Float<t_other> &other) noexcept : Base_Int<T>(static_cast<T>(other.get())) {}
 
     /**
      * @brief assign from integer type with any endianness
@@ -228,7 +236,7 @@ public:
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
     Host_Int<T> &operator=(const Base_Int<t_other> &other) noexcept {
-        Base_Int<T>::data = other.data;
+        Base_Int<T>::data = other.get();
         return *this;
     }
 
@@ -240,7 +248,7 @@ public:
      */
     template <typename t_other, typename = typename std::enable_if_t<std::is_same<T, t_other>::value>>
     Host_Int<T> &operator=(Base_Int<t_other> &&other) noexcept {
-        Base_Int<T>::data = other.data;
+        Base_Int<T>::data = other.get();
         return *this;
     }
 
@@ -260,6 +268,12 @@ public:
      */
     inline T get() const noexcept override { return Base_Int<T>::data; }
 
+    /**
+     * @brief set the value
+     * @param v value in host endian
+     */
+    inline void set(T v) noexcept override { Base_Int<T>::data = v; }
+
     //* default destructor
     ~Host_Int() override = default;
 };
@@ -5,7 +5,7 @@
 
 #pragma once
 
-#include <ostream>
+#include <iosfwd>
 
 #include "int.hpp"
 
@@ -16,82 +16,82 @@ namespace cxxendian {
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Host_Int<T> operator+(const Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    return Host_Int<T>(a.get_raw() + b.get_raw());
+    return Host_Int<T>(static_cast<T>(a.get() + b.get()));
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Base_Int<T> &operator+=(Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    a.get_raw() += b.get_raw();
+    a.set(static_cast<T>(a.get() + b.get()));
     return a;
 }
 
 template <typename T>
 inline Host_Int<T> operator-(const Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    return Host_Int<T>(a.get_raw() - b.get_raw());
+    return Host_Int<T>(static_cast<T>(a.get() - b.get()));
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Base_Int<T> &operator-=(Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    a.get_raw() -= b.get_raw();
+    a.set(static_cast<T>(a.get() - b.get()));
     return a;
 }
 
 template <typename T>
 inline Host_Int<T> operator*(const Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    return Host_Int<T>(a.get_raw() * b.get_raw());
+    return Host_Int<T>(static_cast<T>(a.get() * b.get()));
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Base_Int<T> &operator*=(Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    a.get_raw() *= b.get_raw();
+    a.set(static_cast<T>(a.get() * b.get()));
     return a;
 }
 
 template <typename T>
 inline Host_Int<T> operator/(const Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    return Host_Int<T>(a.get_raw() / b.get_raw());
+    return Host_Int<T>(static_cast<T>(a.get() / b.get()));
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Base_Int<T> &operator/=(Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    a.get_raw() /= b.get_raw();
+    a.set(static_cast<T>(a.get() / b.get()));
     return a;
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Host_Int<T> operator%(const Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    return Host_Int<T>(a.get_raw() % b.get_raw());
+    return Host_Int<T>(static_cast<T>(a.get() % b.get()));
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Base_Int<T> &operator%=(Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    a.get_raw() %= b.get_raw();
+    a.set(static_cast<T>(a.get() % b.get()));
     return a;
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
-inline Host_Int<T> &operator++(Base_Int<T, void> &a) noexcept {
-    ++a.get_raw();
+inline Base_Int<T> &operator++(Base_Int<T, void> &a) noexcept {
+    a.set(static_cast<T>(a.get() + 1));
     return a;
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Host_Int<T> operator++(Base_Int<T, void> &a, int) noexcept {  // NOLINT
     Host_Int<T> ret(a);
-    --a.get_raw();
+    a.set(static_cast<T>(a.get() + 1));
     return ret;
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
-inline Host_Int<T> &operator--(Base_Int<T, void> &a) noexcept {
-    --a.get_raw();
+inline Base_Int<T> &operator--(Base_Int<T, void> &a) noexcept {
+    a.set(static_cast<T>(a.get() - 1));
     return a;
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Host_Int<T> operator--(Base_Int<T, void> &a, int) noexcept {  // NOLINT
     Host_Int<T> ret(a);
-    --a.get_raw();
+    a.set(static_cast<T>(a.get() - 1));
     return ret;
 }
 
@@ -102,100 +102,100 @@ inline Host_Int<T> operator+(const Base_Int<T, void> &a) noexcept {
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Host_Int<T> operator-(const Base_Int<T, void> &a) noexcept {
-    return Host_Int<T>(-a.get_raw());
+    return Host_Int<T>(static_cast<T>(-a.get()));
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline bool operator==(const Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    return a.get_raw() == b.get_raw();
+    return a.get() == b.get();
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline bool operator!=(const Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    return a.get_raw() != b.get_raw();
+    return a.get() != b.get();
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline bool operator>(const Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    return a.get_raw() > b.get_raw();
+    return a.get() > b.get();
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline bool operator<(const Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    return a.get_raw() < b.get_raw();
+    return a.get() < b.get();
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline bool operator>=(const Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    return a.get_raw() >= b.get_raw();
+    return a.get() >= b.get();
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline bool operator<=(const Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    return a.get_raw() <= b.get_raw();
+    return a.get() <= b.get();
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline bool operator!(const Base_Int<T, void> &a) noexcept {
-    return Host_Int<T>(!a.get_raw());
+    return !a.get();
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline bool operator&&(const Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    return a.get_raw() && b.get_raw();
+    return a.get() && b.get();
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline bool operator||(const Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    return a.get_raw() || b.get_raw();
+    return a.get() || b.get();
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Host_Int<T> operator~(const Base_Int<T, void> &a) noexcept {
-    return Host_Int<T>(~a.get_raw());
+    return Host_Int<T>(static_cast<T>(~a.get()));
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Host_Int<T> operator&(const Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    return a.get_raw() & b.get_raw();
+    return Host_Int<T>(static_cast<T>(a.get() & b.get()));
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Base_Int<T> &operator&=(Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    a.get_raw() &= b.get_raw();
+    a.set(static_cast<T>(a.get() & b.get()));
     return a;
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Host_Int<T> operator|(const Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    return a.get_raw() | b.get_raw();
+    return Host_Int<T>(static_cast<T>(a.get() | b.get()));
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Base_Int<T> &operator|=(Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    a.get_raw() |= b.get_raw();
+    a.set(static_cast<T>(a.get() | b.get()));
     return a;
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Host_Int<T> operator^(const Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    return a.get_raw() ^ b.get_raw();
+    return Host_Int<T>(static_cast<T>(a.get() ^ b.get()));
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Base_Int<T> &operator^=(Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    a.get_raw() ^= b.get_raw();
+    a.set(static_cast<T>(a.get() ^ b.get()));
     return a;
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Host_Int<T> operator<<(const Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    return a.get_raw() << b.get_raw();
+    return Host_Int<T>(static_cast<T>(a.get() << b.get()));
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Base_Int<T> &operator<<=(Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    a.get_raw() <<= b.get_raw();
+    a.set(static_cast<T>(a.get() << b.get()));
     return a;
 }
 
@@ -204,7 +204,7 @@ template <typename T,
           typename = typename std::enable_if_t<std::is_integral<T>::value>,
           typename = typename std::enable_if_t<std::is_integral<T2>::value>>
 inline Host_Int<T> operator<<(const Base_Int<T, void> &a, T2 b) noexcept {
-    return a.get_raw() << b;
+    return Host_Int<T>(static_cast<T>(a.get() << b));
 }
 
 template <typename T,
@@ -212,18 +212,18 @@ template <typename T,
           typename = typename std::enable_if_t<std::is_integral<T>::value>,
           typename = typename std::enable_if_t<std::is_integral<T2>::value>>
 inline Base_Int<T> &operator<<=(Base_Int<T, void> &a, T2 b) noexcept {
-    a.get_raw() <<= b;
+    a.set(static_cast<T>(a.get() << b));
     return a;
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Host_Int<T> operator>>(const Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    return a.get_raw() >> b.get_raw();
+    return Host_Int<T>(static_cast<T>(a.get() >> b.get()));
 }
 
 template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
 inline Base_Int<T> &operator>>=(Base_Int<T, void> &a, const Base_Int<T, void> &b) noexcept {
-    a.get_raw() >>= b.get_raw();
+    a.set(static_cast<T>(a.get() >> b.get()));
     return a;
 }
 
@@ -232,7 +232,7 @@ template <typename T,
           typename = typename std::enable_if_t<std::is_integral<T>::value>,
           typename = typename std::enable_if_t<std::is_integral<T2>::value>>
 inline Base_Int<T> &operator>>=(Base_Int<T, void> &a, T2 b) noexcept {
-    a.get_raw() >>= b;
+    a.set(static_cast<T>(a.get() >> b));
     return a;
 }
 
@@ -241,12 +241,15 @@ template <typename T,
           typename = typename std::enable_if_t<std::is_integral<T>::value>,
           typename = typename std::enable_if_t<std::is_integral<T2>::value>>
 inline Host_Int<T> operator>>(const Base_Int<T, void> &a, T2 b) noexcept {
-    return a.get_raw() >> b;
+    return Host_Int<T>(static_cast<T>(a.get() >> b));
 }
 
-template <typename T, typename = typename std::enable_if_t<std::is_integral<T>::value>>
-inline std::ostream &operator<<(std::ostream &o, const Base_Int<T, void> &i) {
-    o << i.get_raw();
+template <typename CharT,
+          typename Traits,
+          typename T,
+          typename = typename std::enable_if_t<std::is_integral<T>::value>>
+inline std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &o, const Base_Int<T, void> &i) {
+    o << i.get();
     return o;
 }
 
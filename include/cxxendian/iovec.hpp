@@ -0,0 +1,421 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#    error "cxxendian/iovec.hpp requires a POSIX system (writev/readv)"
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "bulk.hpp"
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace cxxendian {
+
+namespace detail {
+
+//* converts n elements from src to dst (type erased bulk function)
+using Convert_Function = void (*)(const void *src, void *dst, std::size_t n) noexcept;
+
+template <endian::Order order, typename T>
+void from_host_erased(const void *src, void *dst, std::size_t n) noexcept {
+    endian::from_host_n<order>(static_cast<const T *>(src), dst, n);
+}
+
+template <endian::Order order, typename T>
+void to_host_erased(const void *src, void *dst, std::size_t n) noexcept {
+    endian::to_host_n<order>(src, static_cast<T *>(dst), n);
+}
+
+struct Iovec_Segment {
+    std::uint8_t    *data;
+    std::size_t      bytes;
+    std::size_t      width;    // element size, 0 if no conversion is required
+    Convert_Function convert;  // nullptr if no conversion is required
+};
+
+}  // namespace detail
+
+/**
+ * @brief scatter-gather encoder for writev/sendmsg
+ * @details
+ * Arrays are registered with add and are not copied. Segments that already have the requested byte order (e.g. all
+ * segments of a little endian writer on a little endian host and all byte arrays) are passed to writev as they are.
+ * Only segments that need a conversion are converted into a fixed number of reusable chunk buffers. The memory
+ * usage is therefore bounded by chunk_count * chunk_size, independent of the size of the data.
+ *
+ * The source arrays must stay valid until all data was sent.
+ *
+ * Example:
+ * @code
+ * cxxendian::BE_Iovec_Writer w;
+ * w.add(&header, 1);
+ * w.add(samples, n);
+ * if (!w.write_all(fd)) perror("writev");
+ * @endcode
+ *
+ * Manual loop (e.g. for sendmsg or non-blocking sockets):
+ * @code
+ * while (!w.done()) {
+ *     const auto batch = w.next();
+ *     msghdr msg {};
+ *     msg.msg_iov    = const_cast<iovec *>(batch.iov);
+ *     msg.msg_iovlen = batch.count;
+ *     const auto r = sendmsg(fd, &msg, 0);
+ *     if (r < 0) break;
+ *     w.consume(static_cast<size_t>(r));
+ * }
+ * @endcode
+ *
+ * @tparam order byte order of the serialized data
+ */
+template <endian::Order order>
+class Iovec_Writer {
+    std::vector<detail::Iovec_Segment> segments;
+    std::size_t                        seg     = 0;  // segment that is continued by the next batch
+    std::size_t                        seg_off = 0;  // offset (bytes) in this segment
+
+    std::unique_ptr<std::uint8_t[]> chunk_mem;
+    std::size_t                     chunk_bytes;
+    std::size_t                     chunks;
+    std::size_t                     max_iov;
+
+    std::vector<::iovec> iov;
+    std::size_t          iov_pos = 0;  // first iovec of the current batch that is not completely sent
+
+    std::size_t total = 0;
+    std::size_t sent  = 0;
+
+    void fill_batch() noexcept {
+        iov.clear();
+        iov_pos = 0;
+
+        std::size_t chunk = 0;
+        while (seg < segments.size() && iov.size() < max_iov) {
+            const auto &s = segments[seg];
+
+            if (!s.convert) {
+                iov.push_back({s.data + seg_off, s.bytes - seg_off});
+                ++seg;
+                seg_off = 0;
+                continue;
+            }
+
+            if (chunk == chunks) break;
+            std::uint8_t     *dst   = chunk_mem.get() + chunk++ * chunk_bytes;
+            const std::size_t bytes = std::min(s.bytes - seg_off, chunk_bytes / s.width * s.width);
+            s.convert(s.data + seg_off, dst, bytes / s.width);
+            iov.push_back({dst, bytes});
+
+            seg_off += bytes;
+            if (seg_off == s.bytes) {
+                ++seg;
+                seg_off = 0;
+            }
+        }
+    }
+
+public:
+    //* byte order of the serialized data
+    static constexpr endian::Order byte_order = order;
+
+    //* list of iovecs for one writev/sendmsg call
+    struct Batch {
+        //* first iovec
+        const ::iovec *iov;
+        //* number of iovecs
+        int count;
+    };
+
+    /**
+     * @brief create writer
+     * @param chunk_size size of a conversion buffer in bytes (at least 16)
+     * @param chunk_count number of conversion buffers
+     * @param iov_limit maximum number of iovecs per batch (must not exceed IOV_MAX, 1024 on Linux)
+     * @exception std::bad_alloc allocation of the conversion buffers failed
+     */
+    explicit Iovec_Writer(std::size_t chunk_size = 16 * 1024, std::size_t chunk_count = 8, std::size_t iov_limit = 64)
+            : chunk_bytes(std::max<std::size_t>(chunk_size, 16)),
+              chunks(std::max<std::size_t>(chunk_count, 1)),
+              max_iov(std::max<std::size_t>(iov_limit, 1)) {
+        chunk_mem.reset(new std::uint8_t[chunk_bytes * chunks]);
+        iov.reserve(max_iov);
+    }
+
+    /**
+     * @brief append array
+     * @tparam T base data type (integer or floating point)
+     * @param src values in host byte order (must stay valid until the data was sent)
+     * @param n number of values
+     */
+    template <typename T>
+    void add(const T *src, std::size_t n) {
+        static_assert(std::is_arithmetic<T>::value, "add requires an integer or floating point type");
+        if (!n) return;
+        auto *data = const_cast<std::uint8_t *>(reinterpret_cast<const std::uint8_t *>(src));
+        if constexpr (sizeof(T) == 1 || order == endian::HostOrder) {
+            segments.push_back({data, n * sizeof(T), 0, nullptr});
+        } else {
+            segments.push_back({data, n * sizeof(T), sizeof(T), &detail::from_host_erased<order, T>});
+        }
+        total += n * sizeof(T);
+    }
+
+    /**
+     * @brief append bytes as they are
+     * @param src bytes (must stay valid until the data was sent)
+     * @param bytes number of bytes
+     */
+    void add_bytes(const void *src, std::size_t bytes) { add(static_cast<const std::uint8_t *>(src), bytes); }
+
+    /**
+     * @brief iovecs for the next writev/sendmsg call
+     * @details Converts the next part of the data if the previous batch was sent completely.
+     * @return iovec list (count is 0 if all data was sent)
+     */
+    Batch next() noexcept {
+        if (iov_pos == iov.size()) fill_batch();
+        return {iov.data() + iov_pos, static_cast<int>(iov.size() - iov_pos)};
+    }
+
+    /**
+     * @brief mark bytes of the current batch as sent
+     * @param bytes number of bytes (return value of writev/sendmsg)
+     */
+    void consume(std::size_t bytes) noexcept {
+        sent += bytes;
+        while (bytes && iov_pos < iov.size()) {
+            auto &v = iov[iov_pos];
+            if (bytes >= v.iov_len) {
+                bytes -= v.iov_len;
+                ++iov_pos;
+            } else {
+                v.iov_base = static_cast<std::uint8_t *>(v.iov_base) + bytes;
+                v.iov_len -= bytes;
+                bytes = 0;
+            }
+        }
+    }
+
+    /**
+     * @brief write all remaining data with writev
+     * @details Partial writes and EINTR are handled. For non-blocking file descriptors the function returns false
+     * with errno EAGAIN/EWOULDBLOCK and can be called again later.
+     * @param fd file descriptor
+     * @return true if all data was written, false on error (see errno)
+     */
+    bool write_all(int fd) noexcept {
+        while (!done()) {
+            const auto    batch = next();
+            const ssize_t r     = ::writev(fd, batch.iov, batch.count);
+            if (r < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            consume(static_cast<std::size_t>(r));
+        }
+        return true;
+    }
+
+    //* true if all data was sent
+    bool done() const noexcept { return sent == total; }
+
+    //* total number of bytes
+    std::size_t size() const noexcept { return total; }
+
+    //* number of bytes that are not sent yet
+    std::size_t remaining() const noexcept { return total - sent; }
+
+    //* remove all segments (the conversion buffers are kept)
+    void clear() noexcept {
+        segments.clear();
+        iov.clear();
+        seg = seg_off = iov_pos = total = sent = 0;
+    }
+};
+
+/**
+ * @brief scatter-gather decoder for readv/recvmsg
+ * @details
+ * Destination arrays are registered with add. The data is received directly into the destination arrays (no
+ * staging buffer). Elements that are received completely are converted in place to host byte order.
+ *
+ * Example:
+ * @code
+ * cxxendian::BE_Iovec_Reader r;
+ * r.add(&count, 1);
+ * r.add(samples, n);
+ * if (!r.read_all(fd)) handle_error();
+ * @endcode
+ *
+ * @tparam order byte order of the serialized data
+ */
+template <endian::Order order>
+class Iovec_Reader {
+    std::vector<detail::Iovec_Segment> segments;
+    std::size_t                        seg       = 0;  // first segment that is not completely received
+    std::size_t                        seg_off   = 0;  // received bytes of this segment
+    std::size_t                        converted = 0;  // converted bytes of this segment
+
+    std::size_t max_iov;
+
+    std::vector<::iovec> iov;
+
+    std::size_t total    = 0;
+    std::size_t received = 0;
+
+    void convert_received(const detail::Iovec_Segment &s, std::size_t end) noexcept {
+        if (!s.convert) return;
+        const std::size_t complete = end / s.width * s.width;
+        if (complete > converted) s.convert(s.data + converted, s.data + converted, (complete - converted) / s.width);
+        converted = complete;
+    }
+
+public:
+    //* byte order of the serialized data
+    static constexpr endian::Order byte_order = order;
+
+    //* list of iovecs for one readv/recvmsg call
+    struct Batch {
+        //* first iovec
+        const ::iovec *iov;
+        //* number of iovecs
+        int count;
+    };
+
+    /**
+     * @brief create reader
+     * @param iov_limit maximum number of iovecs per batch (must not exceed IOV_MAX, 1024 on Linux)
+     */
+    explicit Iovec_Reader(std::size_t iov_limit = 64) : max_iov(std::max<std::size_t>(iov_limit, 1)) {
+        iov.reserve(max_iov);
+    }
+
+    /**
+     * @brief append destination array
+     * @tparam T base data type (integer or floating point)
+     * @param dst destination (values in host byte order after they were received)
+     * @param n number of values
+     */
+    template <typename T>
+    void add(T *dst, std::size_t n) {
+        static_assert(std::is_arithmetic<T>::value, "add requires an integer or floating point type");
+        if (!n) return;
+        auto *data = reinterpret_cast<std::uint8_t *>(dst);
+        if constexpr (sizeof(T) == 1 || order == endian::HostOrder) {
+            segments.push_back({data, n * sizeof(T), 0, nullptr});
+        } else {
+            segments.push_back({data, n * sizeof(T), sizeof(T), &detail::to_host_erased<order, T>});
+        }
+        total += n * sizeof(T);
+    }
+
+    /**
+     * @brief append destination for bytes that are received as they are
+     * @param dst destination
+     * @param bytes number of bytes
+     */
+    void add_bytes(void *dst, std::size_t bytes) { add(static_cast<std::uint8_t *>(dst), bytes); }
+
+    /**
+     * @brief iovecs for the next readv/recvmsg call
+     * @return iovec list (count is 0 if all data was received)
+     */
+    Batch next() noexcept {
+        iov.clear();
+        for (std::size_t i = seg; i < segments.size() && iov.size() < max_iov; ++i) {
+            const std::size_t off = i == seg ? seg_off : 0;
+            iov.push_back({segments[i].data + off, segments[i].bytes - off});
+        }
+        return {iov.data(), static_cast<int>(iov.size())};
+    }
+
+    /**
+     * @brief mark bytes as received and convert all completely received elements
+     * @param bytes number of bytes (return value of readv/recvmsg)
+     */
+    void consume(std::size_t bytes) noexcept {
+        received += bytes;
+        while (bytes && seg < segments.size()) {
+            const auto       &s = segments[seg];
+            const std::size_t n = std::min(bytes, s.bytes - seg_off);
+            seg_off += n;
+            bytes -= n;
+            convert_received(s, seg_off);
+            if (seg_off == s.bytes) {
+                ++seg;
+                seg_off   = 0;
+                converted = 0;
+            }
+        }
+    }
+
+    /**
+     * @brief read all remaining data with readv
+     * @details Partial reads and EINTR are handled. For non-blocking file descriptors the function returns false
+     * with errno EAGAIN/EWOULDBLOCK and can be called again later.
+     * @param fd file descriptor
+     * @return true if all data was received, false on error (see errno) or end of file (errno is 0)
+     */
+    bool read_all(int fd) noexcept {
+        while (!done()) {
+            const auto    batch = next();
+            const ssize_t r     = ::readv(fd, batch.iov, batch.count);
+            if (r < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            if (r == 0) {
+                errno = 0;
+                return false;
+            }
+            consume(static_cast<std::size_t>(r));
+        }
+        return true;
+    }
+
+    //* true if all data was received
+    bool done() const noexcept { return received == total; }
+
+    //* total number of bytes
+    std::size_t size() const noexcept { return total; }
+
+    //* number of bytes that are not received yet
+    std::size_t remaining() const noexcept { return total - received; }
+
+    //* remove all segments
+    void clear() noexcept {
+        segments.clear();
+        iov.clear();
+        seg = seg_off = converted = total = received = 0;
+    }
+};
+
+//* big endian scatter-gather encoder
+using BE_Iovec_Writer = Iovec_Writer<endian::Order::Big>;
+
+//* little endian scatter-gather encoder
+using LE_Iovec_Writer = Iovec_Writer<endian::Order::Little>;
+
+//* big endian scatter-gather decoder
+using BE_Iovec_Reader = Iovec_Reader<endian::Order::Big>;
+
+//* little endian scatter-gather decoder
+using LE_Iovec_Reader = Iovec_Reader<endian::Order::Little>;
+
+}  // namespace cxxendian
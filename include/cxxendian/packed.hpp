@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if __cplusplus >= 202002L && defined(__has_include)
+#    if __has_include(<span>)
+#        include <span>
+#    endif
+#endif
+
+#include "endian.hpp"
+#include "traits.hpp"
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace cxxendian {
+
+/**
+ * @brief value with fixed byte order and alignment 1 for wire format struct definitions
+ * @details
+ * In contrast to LE_Int, BE_Int, ... this type has no virtual functions and only stores the bytes of the value.
+ * It is trivially copyable, has the size of T and an alignment of 1. Structs that only contain Packed members
+ * therefore have no padding and can be placed directly on a received buffer (see overlay).
+ *
+ * The value is loaded and stored via an unsigned integer of the same size. Floating point values are never held in
+ * floating point registers in wire order, NaN payloads are preserved.
+ *
+ * @tparam T base data type (integer or floating point)
+ * @tparam order byte order of the stored value
+ */
+template <typename T, endian::Order order>
+class Packed {
+    static_assert(std::is_arithmetic<T>::value, "Packed requires an integer or floating point type");
+
+    //* the value in byte order order
+    std::uint8_t bytes[sizeof(T)];
+
+public:
+    //* uninitialized value (trivial default constructor)
+    Packed() noexcept = default;
+
+    /**
+     * @brief create from base data type
+     * @param v value
+     */
+    explicit Packed(T v) noexcept { set(v); }
+
+    /**
+     * @brief assign from base data type
+     * @param v value
+     * @return this instance
+     */
+    Packed &operator=(T v) noexcept {
+        set(v);
+        return *this;
+    }
+
+    /**
+     * @brief get the value in host endian
+     * @return value
+     */
+    inline T get() const noexcept { return endian::detail::load<order, T>(bytes); }
+
+    /**
+     * @brief set the value
+     * @param v value in host endian
+     */
+    inline void set(T v) noexcept { endian::detail::store<order>(bytes, v); }
+
+    /**
+     * @brief access the stored bytes
+     * @return pointer to sizeof(T) bytes in byte order order
+     */
+    inline const std::uint8_t *data() const noexcept { return bytes; }
+};
+
+//* packed little endian integer
+template <typename T>
+using Packed_LE_Int = Packed<std::enable_if_t<std::is_integral<T>::value, T>, endian::Order::Little>;
+
+//* packed big endian integer
+template <typename T>
+using Packed_BE_Int = Packed<std::enable_if_t<std::is_integral<T>::value, T>, endian::Order::Big>;
+
+//* packed little endian floating point value
+template <typename T>
+using Packed_LE_Float = Packed<std::enable_if_t<std::is_floating_point<T>::value, T>, endian::Order::Little>;
+
+//* packed big endian floating point value
+template <typename T>
+using Packed_BE_Float = Packed<std::enable_if_t<std::is_floating_point<T>::value, T>, endian::Order::Big>;
+
+template <typename T, endian::Order o>
+struct Endian_Traits<Packed<T, o>> {
+    using value_type                     = T;
+    static constexpr endian::Order order = o;
+};
+
+namespace detail {
+
+template <typename Hdr>
+constexpr void check_overlay_type() noexcept {
+    static_assert(std::is_trivially_copyable<Hdr>::value, "overlay type must be trivially copyable");
+    static_assert(std::is_standard_layout<Hdr>::value, "overlay type must have standard layout");
+    static_assert(alignof(Hdr) == 1, "overlay type must have alignment 1 (use Packed_* members only)");
+}
+
+}  // namespace detail
+
+/**
+ * @brief view a received buffer as wire format struct without copying
+ * @details
+ * Hdr must only consist of Packed_* members (or other types with alignment 1). This is checked at compile time.
+ * The size of the buffer is checked at runtime.
+ *
+ * Example:
+ * @code
+ * struct Hdr {
+ *     cxxendian::Packed_BE_Int<uint16_t> type;
+ *     cxxendian::Packed_BE_Int<uint32_t> len;
+ * };
+ * static_assert(sizeof(Hdr) == 6);
+ *
+ * const auto n = recv(fd, buffer, sizeof(buffer), 0);
+ * if (const auto *hdr = cxxendian::overlay<Hdr>(buffer, n)) handle(hdr->type.get(), hdr->len.get());
+ * @endcode
+ *
+ * @tparam Hdr wire format struct
+ * @param data buffer
+ * @param size size of the buffer in bytes
+ * @return pointer to the struct or nullptr if the buffer is too small
+ */
+template <typename Hdr>
+inline const Hdr *overlay(const void *data, std::size_t size) noexcept {
+    detail::check_overlay_type<Hdr>();
+    return size >= sizeof(Hdr) ? static_cast<const Hdr *>(data) : nullptr;
+}
+
+/**
+ * @brief view a buffer as mutable wire format struct without copying
+ * @details see overlay(const void *, std::size_t)
+ * @tparam Hdr wire format struct
+ * @param data buffer
+ * @param size size of the buffer in bytes
+ * @return pointer to the struct or nullptr if the buffer is too small
+ */
+template <typename Hdr>
+inline Hdr *overlay(void *data, std::size_t size) noexcept {
+    detail::check_overlay_type<Hdr>();
+    return size >= sizeof(Hdr) ? static_cast<Hdr *>(data) : nullptr;
+}
+
+/**
+ * @brief view a fixed size buffer as wire format struct without copying
+ * @details The size of the buffer is checked at compile time.
+ * @tparam Hdr wire format struct
+ * @tparam B element type of the buffer (one byte types only)
+ * @tparam N size of the buffer
+ * @param data buffer
+ * @return reference to the struct
+ */
+template <typename Hdr, typename B, std::size_t N>
+inline const Hdr &overlay(const B (&data)[N]) noexcept {
+    static_assert(sizeof(B) == 1, "buffer must be an array of bytes");
+    static_assert(N >= sizeof(Hdr), "buffer is too small for the overlay type");
+    detail::check_overlay_type<Hdr>();
+    return *reinterpret_cast<const Hdr *>(data);
+}
+
+#if defined(__cpp_lib_span)
+/**
+ * @brief view a received buffer as wire format struct without copying
+ * @details see overlay(const void *, std::size_t)
+ * @tparam Hdr wire format struct
+ * @param data buffer
+ * @return pointer to the struct or nullptr if the buffer is too small
+ */
+template <typename Hdr>
+inline const Hdr *overlay(std::span<const std::byte> data) noexcept {
+    return overlay<Hdr>(data.data(), data.size());
+}
+#endif
+
+}  // namespace cxxendian
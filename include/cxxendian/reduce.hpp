@@ -0,0 +1,542 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "bulk.hpp"
+#include "packed.hpp"
+#include "vec_ops.hpp"
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace endian {
+
+/**
+ * @brief summation order of floating point reductions
+ */
+enum class Reduce_Order {
+    /**
+     * @brief as many partial sums as the vector unit needs to be saturated
+     * @details The result only depends on the input, but may differ between builds for different instruction sets.
+     */
+    Fast,
+    /**
+     * @brief fixed summation order
+     * @details Element i is added to partial sum i % 8, the 8 partial sums are combined pairwise
+     * ((s0 + s4) + (s2 + s6)) + ((s1 + s5) + (s3 + s7)). The result is bitwise identical for all instruction sets
+     * (including CXXENDIAN_NO_SIMD) as long as the compiler does not reassociate floating point operations
+     * (-ffast-math). For dot_n, fused multiply-add contraction must be disabled as well (-ffp-contract=off).
+     */
+    Deterministic,
+};
+
+/**
+ * @brief result type of sum_n and dot_n
+ * @details Integers are accumulated in 64 bit (int64_t for signed, uint64_t for unsigned types). Sums of 8, 16 and
+ * 32 bit values therefore can not overflow for any practical array size, sums of 64 bit values wrap around.
+ * Floating point values are accumulated in their own type.
+ * @tparam T data type
+ */
+template <typename T>
+using Sum_Type = std::conditional_t<std::is_floating_point<T>::value,
+                                    T,
+                                    std::conditional_t<std::is_signed<T>::value, std::int64_t, std::uint64_t>>;
+
+namespace detail {
+
+//* number of partial sums of Reduce_Order::Deterministic
+constexpr std::size_t DETERMINISTIC_LANES = 8;
+
+//* number of 16 bit vectors that are accumulated in 32 bit lanes before they are widened to 64 bit
+constexpr std::size_t SUM16_BLOCK = 16384;
+
+template <typename T>
+constexpr void check_reduce_type() noexcept {
+    static_assert(std::is_arithmetic<T>::value, "reductions require an integer or floating point type");
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+                  "reductions require a 1, 2, 4 or 8 byte type");
+}
+
+/**
+ * @brief combine partial sums pairwise (fixed order)
+ */
+template <typename T, std::size_t LANES>
+inline T combine_lanes(T (&lanes)[LANES]) noexcept {
+    for (std::size_t h = LANES / 2; h; h /= 2)
+        for (std::size_t j = 0; j < h; ++j)
+            lanes[j] += lanes[j + h];
+    return lanes[0];
+}
+
+#if defined(CXXENDIAN_HAVE_SSE2)
+/**
+ * @brief vectorized integer sum with 64 bit accumulators
+ * @details
+ *  - 8 bit: sum of absolute differences (signed values are biased to unsigned)
+ *  - 16 bit: multiply-add with 1 into 32 bit lanes (unsigned values are biased to signed), widened to 64 bit every
+ *    SUM16_BLOCK vectors
+ *  - 32 bit: sign or zero extension to 64 bit
+ *  - 64 bit: 64 bit addition (wraps around)
+ * @return sum of the first processed elements (modulo 2^64), processed: number of processed elements
+ */
+template <typename Ops, Order order, typename T>
+inline std::uint64_t sum_int_vec(const std::uint8_t *s, std::size_t n, std::size_t &processed) noexcept {
+    using V                 = typename Ops::V;
+    constexpr std::size_t W = sizeof(T);
+    constexpr std::size_t L = Ops::BYTES / W;
+    constexpr bool        S = std::is_signed<T>::value;
+
+    V           acc = Ops::zero();
+    std::size_t i   = 0;
+    if constexpr (W == 1) {
+        const V bias = S ? Ops::set1_8(std::numeric_limits<std::int8_t>::min()) : Ops::zero();
+        for (; i + L <= n; i += L)
+            acc = Ops::add64(acc, Ops::sad_u8(Ops::bxor(Ops::load(s + i), bias)));
+    } else if constexpr (W == 2) {
+        const V bias = S ? Ops::zero() : Ops::set1_16(std::numeric_limits<std::int16_t>::min());
+        const V ones = Ops::set1_16(1);
+        while (i + L <= n) {
+            const std::size_t end   = i + std::min((n - i) / L, SUM16_BLOCK) * L;
+            V                 acc32 = Ops::zero();
+            for (; i < end; i += L)
+                acc32 = Ops::add32(acc32, Ops::madd16(Ops::bxor(load_vec<Ops, order, W>(s + i * W), bias), ones));
+            const V sign = Ops::sign32(acc32);
+            acc          = Ops::add64(acc, Ops::unpacklo32(acc32, sign));
+            acc          = Ops::add64(acc, Ops::unpackhi32(acc32, sign));
+        }
+    } else if constexpr (W == 4) {
+        for (; i + L <= n; i += L) {
+            const V v    = load_vec<Ops, order, W>(s + i * W);
+            const V sign = S ? Ops::sign32(v) : Ops::zero();
+            acc          = Ops::add64(acc, Ops::unpacklo32(v, sign));
+            acc          = Ops::add64(acc, Ops::unpackhi32(v, sign));
+        }
+    } else {
+        for (; i + L <= n; i += L)
+            acc = Ops::add64(acc, load_vec<Ops, order, W>(s + i * W));
+    }
+
+    std::uint64_t lanes[Ops::BYTES / 8];
+    Ops::store(lanes, acc);
+    std::uint64_t sum = 0;
+    for (const auto lane : lanes)
+        sum += lane;
+
+    // remove the bias
+    if constexpr (W == 1 && S) sum -= std::uint64_t(128) * i;
+    if constexpr (W == 2 && !S) sum += std::uint64_t(32768) * i;
+
+    processed = i;
+    return sum;
+}
+
+/**
+ * @brief vectorized integer minimum or maximum (8, 16 and 32 bit)
+ * @details The values are biased by flipping the sign bit where the instruction set only provides the comparison
+ * with the other signedness.
+ * @return minimum or maximum of the first processed elements (undefined if processed is 0)
+ */
+template <typename Ops, Order order, typename T, bool MAX>
+inline T minmax_int_vec(const std::uint8_t *s, std::size_t n, std::size_t &processed) noexcept {
+    using V                 = typename Ops::V;
+    constexpr std::size_t W = sizeof(T);
+    constexpr std::size_t L = Ops::BYTES / W;
+    constexpr bool        S = std::is_signed<T>::value;
+
+    processed = 0;
+    if (n < L) return T();
+
+    V bias = Ops::zero();
+    if constexpr (W == 1 && S) bias = Ops::set1_8(std::numeric_limits<std::int8_t>::min());
+    if constexpr (W == 2 && !S) bias = Ops::set1_16(std::numeric_limits<std::int16_t>::min());
+    if constexpr (W == 4 && !S) bias = Ops::set1_32(std::numeric_limits<std::int32_t>::min());
+
+    V           acc = Ops::bxor(load_vec<Ops, order, W>(s), bias);
+    std::size_t i   = L;
+    for (; i + L <= n; i += L)
+        acc = Ops::template minmax<W, MAX>(acc, Ops::bxor(load_vec<Ops, order, W>(s + i * W), bias));
+
+    T lanes[L];
+    Ops::store(lanes, Ops::bxor(acc, bias));
+    T r = lanes[0];
+    for (const auto lane : lanes)
+        r = MAX ? (r < lane ? lane : r) : (lane < r ? lane : r);
+
+    processed = i;
+    return r;
+}
+
+/**
+ * @brief products of 32 bit lanes, added to 64 bit accumulators
+ * @details
+ * The products of the even and odd lanes are computed with the unsigned 32 x 32 -> 64 bit multiplication. For signed
+ * values, a * b = ua * ub - 2^32 * ((a < 0 ? ub : 0) + (b < 0 ? ua : 0)) modulo 2^64.
+ */
+template <typename Ops, bool SIGNED>
+inline typename Ops::V dot32(typename Ops::V acc, typename Ops::V x, typename Ops::V y) noexcept {
+    auto even = Ops::mul_u32(x, y);
+    auto odd  = Ops::mul_u32(Ops::srli64(x), Ops::srli64(y));
+    if constexpr (SIGNED) {
+        const auto t = Ops::add32(Ops::band(Ops::sign32(x), y), Ops::band(Ops::sign32(y), x));
+        even         = Ops::sub64(even, Ops::slli64(t));
+        odd          = Ops::sub64(odd, Ops::band(t, Ops::hi32_mask()));
+    }
+    return Ops::add64(acc, Ops::add64(even, odd));
+}
+
+/**
+ * @brief vectorized integer dot product with 64 bit accumulators (16, 32 and 64 bit)
+ * @details 16 bit values are sign or zero extended to 32 bit, 64 bit products are computed modulo 2^64 from three
+ * 32 bit products.
+ * @return dot product of the first processed elements (modulo 2^64), processed: number of processed elements
+ */
+template <typename Ops, Order order, typename T>
+inline std::uint64_t
+        dot_int_vec(const std::uint8_t *a, const std::uint8_t *b, std::size_t n, std::size_t &processed) noexcept {
+    using V                 = typename Ops::V;
+    constexpr std::size_t W = sizeof(T);
+    constexpr std::size_t L = Ops::BYTES / W;
+    constexpr bool        S = std::is_signed<T>::value;
+
+    V           acc = Ops::zero();
+    std::size_t i   = 0;
+    for (; i + L <= n; i += L) {
+        const V x = load_vec<Ops, order, W>(a + i * W);
+        const V y = load_vec<Ops, order, W>(b + i * W);
+        if constexpr (W == 2) {
+            const V sx = S ? Ops::sign16(x) : Ops::zero();
+            const V sy = S ? Ops::sign16(y) : Ops::zero();
+            acc        = dot32<Ops, S>(acc, Ops::unpacklo16(x, sx), Ops::unpacklo16(y, sy));
+            acc        = dot32<Ops, S>(acc, Ops::unpackhi16(x, sx), Ops::unpackhi16(y, sy));
+        } else if constexpr (W == 4) {
+            acc = dot32<Ops, S>(acc, x, y);
+        } else {
+            const V cross = Ops::add64(Ops::mul_u32(Ops::srli64(x), y), Ops::mul_u32(x, Ops::srli64(y)));
+            acc           = Ops::add64(acc, Ops::add64(Ops::mul_u32(x, y), Ops::slli64(cross)));
+        }
+    }
+
+    std::uint64_t lanes[Ops::BYTES / 8];
+    Ops::store(lanes, acc);
+    std::uint64_t sum = 0;
+    for (const auto lane : lanes)
+        sum += lane;
+
+    processed = i;
+    return sum;
+}
+
+/**
+ * @brief vectorized floating point sum or dot product with ACC vector accumulators
+ * @details Partial sum j (j < ACC * lanes per vector) accumulates the elements i with i % (ACC * lanes) == j.
+ */
+template <typename Ops, Order order, typename T, std::size_t ACC, bool DOT>
+inline T sum_float_vec(const std::uint8_t *a, const std::uint8_t *b, std::size_t n) noexcept {
+    constexpr std::size_t W     = sizeof(T);
+    constexpr std::size_t L     = Ops::BYTES / W;
+    constexpr std::size_t LANES = ACC * L;
+
+    using F = decltype(Ops::template fzero<T>());
+
+    F acc[ACC];
+    for (auto &v : acc)
+        v = Ops::template fzero<T>();
+
+    std::size_t i = 0;
+    for (; i + LANES <= n; i += LANES) {
+        for (std::size_t k = 0; k < ACC; ++k) {
+            auto v = Ops::template as_float<T>(load_vec<Ops, order, W>(a + (i + k * L) * W));
+            if constexpr (DOT) v = Ops::mul(v, Ops::template as_float<T>(load_vec<Ops, order, W>(b + (i + k * L) * W)));
+            acc[k] = Ops::add(acc[k], v);
+        }
+    }
+
+    T lanes[LANES];
+    for (std::size_t k = 0; k < ACC; ++k)
+        Ops::store(lanes + k * L, acc[k]);
+    for (std::size_t j = 0; i < n; ++i, ++j) {
+        T v = load<order, T>(a + i * W);
+        if constexpr (DOT) v *= load<order, T>(b + i * W);
+        lanes[j] += v;
+    }
+    return combine_lanes(lanes);
+}
+
+/**
+ * @brief vectorized floating point minimum or maximum
+ * @return minimum or maximum of the first processed elements (undefined if processed is 0)
+ */
+template <typename Ops, Order order, typename T, bool MAX>
+inline T minmax_float_vec(const std::uint8_t *s, std::size_t n, std::size_t &processed) noexcept {
+    constexpr std::size_t W = sizeof(T);
+    constexpr std::size_t L = Ops::BYTES / W;
+
+    processed = 0;
+    if (n < L) return T();
+
+    auto        acc = Ops::template as_float<T>(load_vec<Ops, order, W>(s));
+    std::size_t i   = L;
+    for (; i + L <= n; i += L) {
+        const auto v = Ops::template as_float<T>(load_vec<Ops, order, W>(s + i * W));
+        acc          = MAX ? Ops::max(v, acc) : Ops::min(v, acc);
+    }
+
+    T lanes[L];
+    Ops::store(lanes, acc);
+    T r = lanes[0];
+    for (const auto lane : lanes)
+        r = MAX ? (r < lane ? lane : r) : (lane < r ? lane : r);
+
+    processed = i;
+    return r;
+}
+#endif
+
+/**
+ * @brief floating point sum or dot product with LANES partial sums (scalar)
+ */
+template <Order order, typename T, std::size_t LANES, bool DOT>
+inline T sum_float_scalar(const std::uint8_t *a, const std::uint8_t *b, std::size_t n) noexcept {
+    constexpr std::size_t W = sizeof(T);
+
+    T lanes[LANES] = {};
+    for (std::size_t i = 0; i < n; ++i) {
+        T v = load<order, T>(a + i * W);
+        if constexpr (DOT) v *= load<order, T>(b + i * W);
+        lanes[i % LANES] += v;
+    }
+    return combine_lanes(lanes);
+}
+
+template <Order order, typename T>
+inline Sum_Type<T> sum_int(const std::uint8_t *s, std::size_t n) noexcept {
+    std::size_t   i   = 0;
+    std::uint64_t sum = 0;
+#if defined(CXXENDIAN_HAVE_SSE2)
+    sum = sum_int_vec<Vec_Ops, order, T>(s, n, i);
+#endif
+    for (; i < n; ++i)
+        sum += static_cast<std::uint64_t>(static_cast<Sum_Type<T>>(load<order, T>(s + i * sizeof(T))));
+    return static_cast<Sum_Type<T>>(sum);
+}
+
+template <Order order, typename T>
+inline Sum_Type<T> dot_int(const std::uint8_t *a, const std::uint8_t *b, std::size_t n) noexcept {
+    std::size_t   i   = 0;
+    std::uint64_t sum = 0;
+#if defined(CXXENDIAN_HAVE_SSE2)
+    if constexpr (sizeof(T) > 1) sum = dot_int_vec<Vec_Ops, order, T>(a, b, n, i);
+#endif
+    for (; i < n; ++i) {
+        const auto x = static_cast<Sum_Type<T>>(load<order, T>(a + i * sizeof(T)));
+        const auto y = static_cast<Sum_Type<T>>(load<order, T>(b + i * sizeof(T)));
+        sum += static_cast<std::uint64_t>(x) * static_cast<std::uint64_t>(y);
+    }
+    return static_cast<Sum_Type<T>>(sum);
+}
+
+template <Order order, typename T, bool DOT>
+inline T sum_float(const std::uint8_t *a, const std::uint8_t *b, std::size_t n, Reduce_Order ro) noexcept {
+#if defined(CXXENDIAN_HAVE_SSE2)
+    constexpr std::size_t L = Vec_Ops::BYTES / sizeof(T);
+    static_assert(DETERMINISTIC_LANES % L == 0, "vector is wider than the deterministic summation order");
+    if (ro == Reduce_Order::Deterministic)
+        return sum_float_vec<Vec_Ops, order, T, DETERMINISTIC_LANES / L, DOT>(a, b, n);
+    return sum_float_vec<Vec_Ops, order, T, 4, DOT>(a, b, n);
+#else
+    static_cast<void>(ro);
+    return sum_float_scalar<order, T, DETERMINISTIC_LANES, DOT>(a, b, n);
+#endif
+}
+
+template <Order order, typename T, bool MAX>
+inline T minmax(const std::uint8_t *s, std::size_t n) noexcept {
+    using Limits = std::numeric_limits<T>;
+
+    T           r = MAX ? Limits::min() : Limits::max();
+    std::size_t i = 0;
+    if constexpr (std::is_floating_point<T>::value) r = MAX ? -Limits::infinity() : Limits::infinity();
+#if defined(CXXENDIAN_HAVE_SSE2)
+    if constexpr (std::is_floating_point<T>::value) {
+        const T v = minmax_float_vec<Vec_Ops, order, T, MAX>(s, n, i);
+        if (i) r = v;
+    } else if constexpr (sizeof(T) <= 4) {
+        const T v = minmax_int_vec<Vec_Ops, order, T, MAX>(s, n, i);
+        if (i) r = v;
+    }
+#endif
+    for (; i < n; ++i) {
+        const T v = load<order, T>(s + i * sizeof(T));
+        r         = MAX ? (r < v ? v : r) : (v < r ? v : r);
+    }
+    return r;
+}
+
+}  // namespace detail
+
+/**
+ * @brief sum of an array in the given byte order
+ * @details
+ * The elements are loaded in wire order and converted in register. No host endian copy of the array is created.
+ * Integers are accumulated in 64 bit (see Sum_Type). Floating point values are summed in the order given by ro.
+ *
+ * Example:
+ * @code
+ * const int64_t total = endian::sum_n<endian::Order::Big, int32_t>(column, rows);
+ * @endcode
+ *
+ * @tparam order byte order of src
+ * @tparam T data type of the elements
+ * @param src input (n elements of type T in byte order order, no alignment required)
+ * @param n number of elements
+ * @param ro summation order (floating point only)
+ * @return sum of the elements (0 if n is 0)
+ */
+template <Order order, typename T>
+inline Sum_Type<T> sum_n(const void *src, std::size_t n, Reduce_Order ro = Reduce_Order::Fast) noexcept {
+    detail::check_reduce_type<T>();
+    CXXENDIAN_COUNT_BULK(detail::to_host_direction(order), sizeof(T), n);
+    const auto *s = static_cast<const std::uint8_t *>(src);
+    if constexpr (std::is_floating_point<T>::value) return detail::sum_float<order, T, false>(s, s, n, ro);
+    else {
+        static_cast<void>(ro);
+        return detail::sum_int<order, T>(s, n);
+    }
+}
+
+/**
+ * @brief minimum of an array in the given byte order
+ * @details
+ * See sum_n. If the array contains NaN, the result is unspecified (but one of the elements). For n = 0 the result is
+ * the largest value of T (infinity for floating point types).
+ * @tparam order byte order of src
+ * @tparam T data type of the elements
+ * @param src input (n elements of type T in byte order order, no alignment required)
+ * @param n number of elements
+ * @return minimum
+ */
+template <Order order, typename T>
+inline T min_n(const void *src, std::size_t n) noexcept {
+    detail::check_reduce_type<T>();
+    CXXENDIAN_COUNT_BULK(detail::to_host_direction(order), sizeof(T), n);
+    return detail::minmax<order, T, false>(static_cast<const std::uint8_t *>(src), n);
+}
+
+/**
+ * @brief maximum of an array in the given byte order
+ * @details
+ * See sum_n. If the array contains NaN, the result is unspecified (but one of the elements). For n = 0 the result is
+ * the lowest value of T (-infinity for floating point types).
+ * @tparam order byte order of src
+ * @tparam T data type of the elements
+ * @param src input (n elements of type T in byte order order, no alignment required)
+ * @param n number of elements
+ * @return maximum
+ */
+template <Order order, typename T>
+inline T max_n(const void *src, std::size_t n) noexcept {
+    detail::check_reduce_type<T>();
+    CXXENDIAN_COUNT_BULK(detail::to_host_direction(order), sizeof(T), n);
+    return detail::minmax<order, T, true>(static_cast<const std::uint8_t *>(src), n);
+}
+
+/**
+ * @brief dot product of two arrays in the given byte order
+ * @details
+ * See sum_n. Integer products are computed in Sum_Type (64 bit products of 64 bit values wrap around). Floating point
+ * products are computed in T and summed in the order given by ro.
+ * @tparam order byte order of a and b
+ * @tparam T data type of the elements
+ * @param a first input (n elements of type T in byte order order, no alignment required)
+ * @param b second input (n elements of type T in byte order order, no alignment required)
+ * @param n number of elements
+ * @param ro summation order (floating point only)
+ * @return sum of a[i] * b[i]
+ */
+template <Order order, typename T>
+inline Sum_Type<T> dot_n(const void *a, const void *b, std::size_t n, Reduce_Order ro = Reduce_Order::Fast) noexcept {
+    detail::check_reduce_type<T>();
+    CXXENDIAN_COUNT_BULK(detail::to_host_direction(order), sizeof(T), 2 * n);
+    const auto *pa = static_cast<const std::uint8_t *>(a);
+    const auto *pb = static_cast<const std::uint8_t *>(b);
+    if constexpr (std::is_floating_point<T>::value) return detail::sum_float<order, T, true>(pa, pb, n, ro);
+    else {
+        static_cast<void>(ro);
+        return detail::dot_int<order, T>(pa, pb, n);
+    }
+}
+
+}  // namespace endian
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace cxxendian {
+
+using endian::Reduce_Order;
+
+/**
+ * @brief sum of an array of packed values
+ * @details see endian::sum_n
+ * @param values input
+ * @param n number of elements
+ * @param ro summation order (floating point only)
+ * @return sum of the values
+ */
+template <typename T, endian::Order order>
+inline endian::Sum_Type<T>
+        sum(const Packed<T, order> *values, std::size_t n, Reduce_Order ro = Reduce_Order::Fast) noexcept {
+    return endian::sum_n<order, T>(values, n, ro);
+}
+
+/**
+ * @brief minimum of an array of packed values
+ * @details see endian::min_n
+ * @param values input
+ * @param n number of elements
+ * @return minimum of the values
+ */
+template <typename T, endian::Order order>
+inline T minimum(const Packed<T, order> *values, std::size_t n) noexcept {
+    return endian::min_n<order, T>(values, n);
+}
+
+/**
+ * @brief maximum of an array of packed values
+ * @details see endian::max_n
+ * @param values input
+ * @param n number of elements
+ * @return maximum of the values
+ */
+template <typename T, endian::Order order>
+inline T maximum(const Packed<T, order> *values, std::size_t n) noexcept {
+    return endian::max_n<order, T>(values, n);
+}
+
+/**
+ * @brief dot product of two arrays of packed values
+ * @details see endian::dot_n
+ * @param a first input
+ * @param b second input
+ * @param n number of elements
+ * @param ro summation order (floating point only)
+ * @return sum of a[i] * b[i]
+ */
+template <typename T, endian::Order order>
+inline endian::Sum_Type<T> dot(const Packed<T, order> *a,
+                               const Packed<T, order> *b,
+                               std::size_t             n,
+                               Reduce_Order            ro = Reduce_Order::Fast) noexcept {
+    return endian::dot_n<order, T>(a, b, n, ro);
+}
+
+}  // namespace cxxendian
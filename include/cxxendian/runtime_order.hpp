@@ -0,0 +1,316 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "bulk.hpp"
+#include "columnar.hpp"
+#include "packed.hpp"
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace endian {
+
+/**
+ * @brief bulk conversion kernels of a data type for one byte order
+ * @tparam T data type
+ */
+template <typename T>
+struct Bulk_Kernels {
+    //* convert n elements from the byte order of the kernels to host endian (see to_host_n)
+    void (*to_host_n)(const void *src, T *dst, std::size_t n) noexcept;
+    //* convert n elements from host endian to the byte order of the kernels (see from_host_n)
+    void (*from_host_n)(const T *src, void *dst, std::size_t n) noexcept;
+};
+
+/**
+ * @brief select the bulk conversion kernels for a byte order that is only known at run time
+ * @details
+ * The selection is a table lookup (no branch). Select the kernels once per buffer and call them for all arrays of the
+ * buffer.
+ * @tparam T data type
+ * @param order byte order of the data
+ * @return kernels (static storage)
+ */
+template <typename T>
+inline const Bulk_Kernels<T> &bulk_kernels(Order order) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value, "bulk_kernels requires a trivially copyable type");
+    static constexpr Bulk_Kernels<T> KERNELS[2] = {{&to_host_n<Order::Little, T>, &from_host_n<Order::Little, T>},
+                                                   {&to_host_n<Order::Big, T>, &from_host_n<Order::Big, T>}};
+    return KERNELS[order == Order::Big];
+}
+
+/**
+ * @brief convert an array from a byte order that is only known at run time to host endian
+ * @details see to_host_n<order> and bulk_kernels
+ * @tparam T data type
+ * @param order byte order of src
+ * @param src input (n elements of type T in byte order order)
+ * @param dst output
+ * @param n number of elements
+ */
+template <typename T>
+inline void to_host_n(Order order, const void *src, T *dst, std::size_t n) noexcept {
+    bulk_kernels<T>(order).to_host_n(src, dst, n);
+}
+
+/**
+ * @brief convert an array from host endian to a byte order that is only known at run time
+ * @details see from_host_n<order> and bulk_kernels
+ * @tparam T data type
+ * @param order byte order of dst
+ * @param src input
+ * @param dst output (n elements of type T in byte order order)
+ * @param n number of elements
+ */
+template <typename T>
+inline void from_host_n(Order order, const T *src, void *dst, std::size_t n) noexcept {
+    bulk_kernels<T>(order).from_host_n(src, dst, n);
+}
+
+/**
+ * @brief call f with the byte order as compile time constant
+ * @details
+ * Instantiates f once per byte order and selects the instance at run time. Loops that are written once as generic
+ * lambda are compiled with the fixed byte order (no run time check inside the loop).
+ *
+ * Example:
+ * @code
+ * const auto order = header.magic == 0x4D4D ? endian::Order::Big : endian::Order::Little;
+ * endian::visit_order(order, [&](auto o) {
+ *     cxxendian::Reader<decltype(o)::value> r(data, size);
+ *     for (auto &entry : entries)
+ *         entry.tag = r.template get<uint16_t>();
+ * });
+ * @endcode
+ *
+ * @param order byte order
+ * @param f callable with a std::integral_constant<Order, ...> argument (same return type for both orders)
+ * @return return value of f
+ */
+template <typename F>
+inline decltype(auto) visit_order(Order order, F &&f) {
+    if (order == Order::Big) return f(std::integral_constant<Order, Order::Big>());
+    return f(std::integral_constant<Order, Order::Little>());
+}
+
+/**
+ * @brief byte order that is only known at run time (e.g. declared in a file header)
+ * @details
+ * Whether the data must be swapped is resolved once on construction. Scalar access swaps with a mask instead of a
+ * branch. The bulk conversions use the kernels of the byte order (see bulk_kernels).
+ *
+ * Example:
+ * @code
+ * const endian::Runtime_Order order(tiff[0] == 'M' ? endian::Order::Big : endian::Order::Little);
+ * const auto ifd_offset = order.load<uint32_t>(tiff + 4);
+ * order.to_host_n(tiff + strip_offset, samples, n);
+ * @endcode
+ */
+class Runtime_Order {
+    Order         wire_order;
+    std::uint64_t swap_mask;  // all bits set if the data has to be swapped
+
+    template <typename U>
+    inline U swap_if(U u) const noexcept {
+        return static_cast<U>(u ^ ((u ^ detail::bswap(u)) & static_cast<U>(swap_mask)));
+    }
+
+public:
+    /**
+     * @brief create from byte order
+     * @param order byte order of the data
+     */
+    constexpr explicit Runtime_Order(Order order) noexcept
+            : wire_order(order), swap_mask(order == HostOrder ? 0 : ~std::uint64_t(0)) {}
+
+    /**
+     * @brief byte order of the data
+     * @return byte order
+     */
+    [[nodiscard]] constexpr Order order() const noexcept { return wire_order; }
+
+    /**
+     * @brief check whether the data must be swapped
+     * @return true if the byte order of the data is not the host byte order
+     */
+    [[nodiscard]] constexpr bool needs_swap() const noexcept { return swap_mask != 0; }
+
+    /**
+     * @brief load value
+     * @tparam T base data type (integer or floating point)
+     * @param src source (sizeof(T) bytes in the byte order of the data, any alignment)
+     * @return value in host byte order
+     */
+    template <typename T>
+    [[nodiscard]] inline T load(const void *src) const noexcept {
+        static_assert(std::is_arithmetic<T>::value, "load requires an integer or floating point type");
+        typename detail::Uint_Of<sizeof(T)>::type u;
+        std::memcpy(&u, src, sizeof(T));
+        return detail::from_bits<T>(swap_if(u));
+    }
+
+    /**
+     * @brief store value
+     * @tparam T base data type (integer or floating point)
+     * @param dst destination (sizeof(T) bytes, any alignment)
+     * @param v value in host byte order
+     */
+    template <typename T>
+    inline void store(void *dst, T v) const noexcept {
+        static_assert(std::is_arithmetic<T>::value, "store requires an integer or floating point type");
+        const auto u = swap_if(detail::to_bits(v));
+        std::memcpy(dst, &u, sizeof(T));
+    }
+
+    /**
+     * @brief convert an array to host endian
+     * @tparam T data type
+     * @param src input (n elements of type T in the byte order of the data)
+     * @param dst output
+     * @param n number of elements
+     */
+    template <typename T>
+    inline void to_host_n(const void *src, T *dst, std::size_t n) const noexcept {
+        bulk_kernels<T>(wire_order).to_host_n(src, dst, n);
+    }
+
+    /**
+     * @brief convert an array from host endian
+     * @tparam T data type
+     * @param src input
+     * @param dst output (n elements of type T in the byte order of the data)
+     * @param n number of elements
+     */
+    template <typename T>
+    inline void from_host_n(const T *src, void *dst, std::size_t n) const noexcept {
+        bulk_kernels<T>(wire_order).from_host_n(src, dst, n);
+    }
+};
+
+}  // namespace endian
+
+namespace cxxendian {
+
+/**
+ * @brief field of a wire format record whose byte order is only known at run time
+ * @tparam T base data type of the field (integer or floating point)
+ * @tparam Offset byte offset of the field within the record
+ */
+template <typename T, std::size_t Offset>
+struct Dynamic_Field {
+    static_assert(std::is_arithmetic<T>::value, "Dynamic_Field requires an integer or floating point type");
+    //* base data type of the field (type of the host endian column)
+    using value_type = T;
+    //* byte offset of the field within the record
+    static constexpr std::size_t offset = Offset;
+    //* size of the field in bytes
+    static constexpr std::size_t size = sizeof(T);
+};
+
+/**
+ * @brief decoder/encoder for arrays of wire format records with a byte order that is only known at run time
+ * @details
+ * Same as Record_Codec, but all fields use the byte order that is passed to decode/encode. The codec is instantiated
+ * for both byte orders, the instance is selected once per call from a function table.
+ *
+ * Example:
+ * @code
+ * using Entry = cxxendian::Dynamic_Record_Codec<cxxendian::Dynamic_Field<uint16_t, 0>,
+ *                                               cxxendian::Dynamic_Field<uint16_t, 2>,
+ *                                               cxxendian::Dynamic_Field<uint32_t, 4>,
+ *                                               cxxendian::Dynamic_Field<uint32_t, 8>>;
+ * Entry::decode(order, ifd + 2, count, tags, types, counts, offsets);
+ * @endcode
+ *
+ * @tparam Fields record fields (Dynamic_Field<T, Offset>)
+ */
+template <typename... Fields>
+class Dynamic_Record_Codec {
+    template <endian::Order order>
+    using Codec = Record_Codec<Field<Packed<typename Fields::value_type, order>, Fields::offset>...>;
+
+    using Decode = void (*)(const void *, std::size_t, std::size_t, typename Fields::value_type *...) noexcept;
+    using Encode = void (*)(void *, std::size_t, std::size_t, const typename Fields::value_type *...) noexcept;
+
+    static constexpr Decode DECODE[2] = {&Codec<endian::Order::Little>::decode_strided,
+                                         &Codec<endian::Order::Big>::decode_strided};
+    static constexpr Encode ENCODE[2] = {&Codec<endian::Order::Little>::encode_strided,
+                                         &Codec<endian::Order::Big>::encode_strided};
+
+public:
+    //* size of a record in bytes
+    static constexpr std::size_t size = Codec<endian::Order::Big>::size;
+
+    /**
+     * @brief decode records that are stored with a distance of stride bytes
+     * @param order byte order of the records
+     * @param records first record (no alignment required)
+     * @param stride distance between two records in bytes (>= size)
+     * @param n number of records
+     * @param columns one output array with n elements per field (same order as Fields)
+     */
+    static void decode_strided(endian::Order order,
+                               const void   *records,
+                               std::size_t   stride,
+                               std::size_t   n,
+                               typename Fields::value_type *...columns) noexcept {
+        DECODE[order == endian::Order::Big](records, stride, n, columns...);
+    }
+
+    /**
+     * @brief decode densely packed records (stride == size)
+     * @param order byte order of the records
+     * @param records first record (no alignment required)
+     * @param n number of records
+     * @param columns one output array with n elements per field (same order as Fields)
+     */
+    static void decode(endian::Order                order,
+                       const void                  *records,
+                       std::size_t                  n,
+                       typename Fields::value_type *...columns) noexcept {
+        decode_strided(order, records, size, n, columns...);
+    }
+
+    /**
+     * @brief encode records that are stored with a distance of stride bytes
+     * @details Bytes that do not belong to a field are not modified.
+     * @param order byte order of the records
+     * @param records first record (no alignment required)
+     * @param stride distance between two records in bytes (>= size)
+     * @param n number of records
+     * @param columns one input array with n elements per field (same order as Fields)
+     */
+    static void encode_strided(endian::Order order,
+                               void         *records,
+                               std::size_t   stride,
+                               std::size_t   n,
+                               const typename Fields::value_type *...columns) noexcept {
+        ENCODE[order == endian::Order::Big](records, stride, n, columns...);
+    }
+
+    /**
+     * @brief encode densely packed records (stride == size)
+     * @details Bytes that do not belong to a field are not modified.
+     * @param order byte order of the records
+     * @param records first record (no alignment required)
+     * @param n number of records
+     * @param columns one input array with n elements per field (same order as Fields)
+     */
+    static void encode(endian::Order order,
+                       void         *records,
+                       std::size_t   n,
+                       const typename Fields::value_type *...columns) noexcept {
+        encode_strided(order, records, size, n, columns...);
+    }
+};
+
+}  // namespace cxxendian
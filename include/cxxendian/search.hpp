@@ -0,0 +1,468 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "bulk.hpp"
+#include "packed.hpp"
+#include "vec_ops.hpp"
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace endian {
+
+namespace detail {
+
+template <typename T>
+constexpr void check_search_type() noexcept {
+    static_assert(std::is_arithmetic<T>::value, "search requires an integer or floating point type");
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+                  "search requires a 1, 2, 4 or 8 byte type");
+}
+
+/**
+ * @brief scalar equality test of one element in byte order order
+ * @details Integers are compared in wire order with the swapped needle, floating point values with ==.
+ */
+template <Order order, typename T>
+struct Equal_Scalar {
+    using U = typename Uint_Of<sizeof(T)>::type;
+
+    T value;
+    U wire;
+
+    explicit Equal_Scalar(T v) noexcept : value(v), wire(to_bits(v)) {
+        if constexpr (order != HostOrder) wire = bswap(wire);
+    }
+
+    bool operator()(const std::uint8_t *p) const noexcept {
+        if constexpr (std::is_floating_point<T>::value) {
+#if defined(__GNUC__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wfloat-equal"
+#endif
+            // IEEE comparison (-0.0 == 0.0, NaN never equal), same as the vector kernels
+            return load<order, T>(p) == value;
+#if defined(__GNUC__)
+#    pragma GCC diagnostic pop
+#endif
+        } else {
+            return load<HostOrder, U>(p) == wire;
+        }
+    }
+};
+
+/**
+ * @brief scalar range test lo <= x <= hi of one element in byte order order
+ */
+template <Order order, typename T>
+struct Range_Scalar {
+    T lo;
+    T hi;
+
+    bool operator()(const std::uint8_t *p) const noexcept {
+        const T v = load<order, T>(p);
+        return lo <= v && v <= hi;
+    }
+};
+
+//* vectorized tests (only defined if a vector instruction set is available)
+template <typename Ops, Order order, typename T>
+struct Equal_Vec;
+template <typename Ops, Order order, typename T>
+struct Range_Vec;
+
+#if defined(CXXENDIAN_HAVE_SSE2)
+/**
+ * @brief vectorized equality test
+ * @details Integers: the needle is swapped once, the data is compared in wire order without swapping.
+ * Floating point values are swapped in register and compared with ==.
+ */
+template <typename Ops, Order order, typename T>
+struct Equal_Vec {
+    static constexpr bool ENABLED = true;
+
+    typename Ops::V needle;
+
+    explicit Equal_Vec(T v) noexcept {
+        if constexpr (std::is_floating_point<T>::value) needle = Ops::template set1<sizeof(T)>(to_bits(v));
+        else needle = Ops::template set1<sizeof(T)>(to_bits(Equal_Scalar<order, T>(v).wire));
+    }
+
+    typename Ops::V operator()(const std::uint8_t *p) const noexcept {
+        if constexpr (std::is_floating_point<T>::value)
+            return Ops::template cmpeq_f<T>(load_vec<Ops, order, sizeof(T)>(p), needle);
+        else return Ops::template cmpeq<sizeof(T)>(Ops::load(p), needle);
+    }
+};
+
+/**
+ * @brief vectorized range test lo <= x <= hi
+ * @details The data is swapped in register. Unsigned integers are biased by flipping the sign bit and compared with
+ * the signed comparison.
+ */
+template <typename Ops, Order order, typename T>
+struct Range_Vec {
+    using V = typename Ops::V;
+
+    static constexpr std::size_t W       = sizeof(T);
+    static constexpr bool        ENABLED = std::is_floating_point<T>::value || W < 8 || Ops::CMPGT64;
+
+    V lo;
+    V hi;
+    V bias;
+
+    Range_Vec(T l, T h) noexcept {
+        bias = Ops::zero();
+        if constexpr (std::is_unsigned<T>::value) bias = Ops::template set1<W>(std::uint64_t(1) << (8 * W - 1));
+        lo = Ops::bxor(Ops::template set1<W>(to_bits(l)), bias);
+        hi = Ops::bxor(Ops::template set1<W>(to_bits(h)), bias);
+    }
+
+    V operator()(const std::uint8_t *p) const noexcept {
+        const V x = load_vec<Ops, order, W>(p);
+        if constexpr (std::is_floating_point<T>::value) {
+            return Ops::band(Ops::template cmple_f<T>(lo, x), Ops::template cmple_f<T>(x, hi));
+        } else {
+            const V b = Ops::bxor(x, bias);
+            return Ops::bxor(Ops::bor(Ops::template cmpgt<W>(lo, b), Ops::template cmpgt<W>(b, hi)), Ops::ones());
+        }
+    }
+};
+
+/**
+ * @brief apply a vectorized test to all complete vectors of the input
+ * @details sink(i, mask) is called with the index of the first element of the vector and one bit per element. The
+ * scan stops early if sink returns false.
+ * @return index of the first element that was not passed to sink
+ */
+template <typename Ops, std::size_t W, typename Test, typename Sink>
+inline std::size_t scan_vec(const std::uint8_t *s, std::size_t n, const Test &test, Sink &&sink) noexcept {
+    constexpr std::size_t L = Ops::BYTES / W;
+
+    std::size_t i = 0;
+    for (; i + L <= n; i += L)
+        if (!sink(i, Ops::template mask<W>(test(s + i * W)))) break;
+    return i;
+}
+#endif
+
+/**
+ * @brief apply a test to all elements
+ * @details Uses the vectorized test Vec_Test<Ops, order, T> if available, the scalar test for the rest. sink(i, mask)
+ * is called with the index of the first element and one bit per element for up to 32 elements that do not cross a
+ * multiple of 32. The scan stops early if sink returns false.
+ */
+template <template <typename, Order, typename> class Vec_Test,
+          Order order,
+          typename T,
+          typename Scalar_Test,
+          typename Sink,
+          typename... Args>
+inline void scan(const std::uint8_t *s, std::size_t n, const Scalar_Test &scalar, Sink &&sink, Args... args) noexcept {
+    std::size_t i = 0;
+#if defined(CXXENDIAN_HAVE_SSE2)
+    using Test = Vec_Test<Vec_Ops, order, T>;
+    if constexpr (Test::ENABLED) {
+        bool go_on = true;
+        i          = scan_vec<Vec_Ops, sizeof(T)>(s, n, Test(args...), [&](std::size_t k, std::uint32_t m) {
+            return go_on = sink(k, m);
+        });
+        if (!go_on) return;
+    }
+#else
+    (static_cast<void>(args), ...);
+#endif
+    while (i < n) {
+        // chunks end at multiples of 32 elements (the vectorized part ends at a multiple of the vector size)
+        const std::size_t k = std::min<std::size_t>(n - i, 32 - i % 32);
+        std::uint32_t     m = 0;
+        for (std::size_t j = 0; j < k; ++j)
+            m |= static_cast<std::uint32_t>(scalar(s + (i + j) * sizeof(T))) << j;
+        if (!sink(i, m)) return;
+        i += k;
+    }
+}
+
+}  // namespace detail
+
+/**
+ * @brief find the first element that is equal to value
+ * @details
+ * The array is searched in wire byte order. For integers, only the needle is converted (the data is not swapped at
+ * all). Floating point values are compared with == (-0.0 equals 0.0, NaN is never found).
+ * @tparam order byte order of src
+ * @tparam T data type of the elements
+ * @param src input (n elements of type T in byte order order, no alignment required)
+ * @param n number of elements
+ * @param value value to search for (host endian)
+ * @return index of the first match or n if there is none
+ */
+template <Order order, typename T>
+inline std::size_t find_n(const void *src, std::size_t n, T value) noexcept {
+    detail::check_search_type<T>();
+    std::size_t found = n;
+    detail::scan<detail::Equal_Vec, order, T>(
+            static_cast<const std::uint8_t *>(src),
+            n,
+            detail::Equal_Scalar<order, T>(value),
+            [&](std::size_t i, std::uint32_t m) {
+                if (m) found = i + detail::lowest_bit(m);
+                return !m;
+            },
+            value);
+    return found;
+}
+
+/**
+ * @brief count the elements that are equal to value
+ * @details see find_n
+ * @tparam order byte order of src
+ * @tparam T data type of the elements
+ * @param src input (n elements of type T in byte order order, no alignment required)
+ * @param n number of elements
+ * @param value value to search for (host endian)
+ * @return number of matches
+ */
+template <Order order, typename T>
+inline std::size_t count_n(const void *src, std::size_t n, T value) noexcept {
+    detail::check_search_type<T>();
+    std::size_t count = 0;
+    detail::scan<detail::Equal_Vec, order, T>(
+            static_cast<const std::uint8_t *>(src),
+            n,
+            detail::Equal_Scalar<order, T>(value),
+            [&](std::size_t, std::uint32_t m) {
+                count += detail::count_bits(m);
+                return true;
+            },
+            value);
+    return count;
+}
+
+/**
+ * @brief index of the first element that is not less than value in a sorted array
+ * @details
+ * Branchless binary search: only the log2(n) probed elements are converted. The array must be sorted in ascending
+ * order of the host endian values.
+ * @tparam order byte order of src
+ * @tparam T data type of the elements
+ * @param src input (n elements of type T in byte order order, no alignment required)
+ * @param n number of elements
+ * @param value value to search for (host endian)
+ * @return index in [0, n]
+ */
+template <Order order, typename T>
+inline std::size_t lower_bound_n(const void *src, std::size_t n, T value) noexcept {
+    detail::check_search_type<T>();
+    if (!n) return 0;
+    const auto *s   = static_cast<const std::uint8_t *>(src);
+    std::size_t lo  = 0;
+    std::size_t len = n;
+    while (len > 1) {
+        const std::size_t half = len / 2;
+        if (detail::load<order, T>(s + (lo + half - 1) * sizeof(T)) < value) lo += half;
+        len -= half;
+    }
+    return lo + (detail::load<order, T>(s + lo * sizeof(T)) < value);
+}
+
+/**
+ * @brief index of the first element that is greater than value in a sorted array
+ * @details see lower_bound_n
+ * @tparam order byte order of src
+ * @tparam T data type of the elements
+ * @param src input (n elements of type T in byte order order, no alignment required)
+ * @param n number of elements
+ * @param value value to search for (host endian)
+ * @return index in [0, n]
+ */
+template <Order order, typename T>
+inline std::size_t upper_bound_n(const void *src, std::size_t n, T value) noexcept {
+    detail::check_search_type<T>();
+    if (!n) return 0;
+    const auto *s   = static_cast<const std::uint8_t *>(src);
+    std::size_t lo  = 0;
+    std::size_t len = n;
+    while (len > 1) {
+        const std::size_t half = len / 2;
+        if (!(value < detail::load<order, T>(s + (lo + half - 1) * sizeof(T)))) lo += half;
+        len -= half;
+    }
+    return lo + !(value < detail::load<order, T>(s + lo * sizeof(T)));
+}
+
+/**
+ * @brief select the elements in the range [lo, hi] (bitmask)
+ * @details
+ * The comparison is done in register after an in register byte swap. Floating point NaN is never selected.
+ * @tparam order byte order of src
+ * @tparam T data type of the elements
+ * @param src input (n elements of type T in byte order order, no alignment required)
+ * @param n number of elements
+ * @param lo lower bound (inclusive, host endian)
+ * @param hi upper bound (inclusive, host endian)
+ * @param mask output: (n + 63) / 64 words, bit i % 64 of word i / 64 is set if element i is selected. Bits beyond n
+ * are cleared.
+ * @return number of selected elements
+ */
+template <Order order, typename T>
+inline std::size_t filter_mask_n(const void *src, std::size_t n, T lo, T hi, std::uint64_t *mask) noexcept {
+    detail::check_search_type<T>();
+    std::size_t   count = 0;
+    std::size_t   index = 0;  // index of the current mask word
+    std::uint64_t word  = 0;
+    detail::scan<detail::Range_Vec, order, T>(
+            static_cast<const std::uint8_t *>(src),
+            n,
+            detail::Range_Scalar<order, T> {lo, hi},
+            [&](std::size_t i, std::uint32_t m) {
+                // the elements are passed in order and a call never crosses a word boundary
+                if (i / 64 != index) {
+                    mask[index] = word;
+                    count += detail::count_bits(word);
+                    word  = 0;
+                    index = i / 64;
+                }
+                word |= std::uint64_t(m) << (i % 64);
+                return true;
+            },
+            lo,
+            hi);
+    if (n) {
+        mask[index] = word;
+        count += detail::count_bits(word);
+    }
+    return count;
+}
+
+/**
+ * @brief select the elements in the range [lo, hi] (index list)
+ * @details see filter_mask_n
+ * @tparam order byte order of src
+ * @tparam T data type of the elements
+ * @param src input (n elements of type T in byte order order, no alignment required)
+ * @param n number of elements
+ * @param lo lower bound (inclusive, host endian)
+ * @param hi upper bound (inclusive, host endian)
+ * @param indices output: ascending indices of the selected elements (space for n indices required)
+ * @return number of selected elements
+ */
+template <Order order, typename T>
+inline std::size_t filter_index_n(const void *src, std::size_t n, T lo, T hi, std::size_t *indices) noexcept {
+    detail::check_search_type<T>();
+    std::size_t count = 0;
+    detail::scan<detail::Range_Vec, order, T>(
+            static_cast<const std::uint8_t *>(src),
+            n,
+            detail::Range_Scalar<order, T> {lo, hi},
+            [&](std::size_t i, std::uint32_t m) {
+                for (; m; m &= m - 1)
+                    indices[count++] = i + detail::lowest_bit(m);
+                return true;
+            },
+            lo,
+            hi);
+    return count;
+}
+
+}  // namespace endian
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace cxxendian {
+
+/**
+ * @brief find the first element of an array of packed values that is equal to value
+ * @details see endian::find_n
+ * @param values input
+ * @param n number of elements
+ * @param value value to search for
+ * @return index of the first match or n if there is none
+ */
+template <typename T, endian::Order order>
+inline std::size_t find(const Packed<T, order> *values, std::size_t n, T value) noexcept {
+    return endian::find_n<order, T>(values, n, value);
+}
+
+/**
+ * @brief count the elements of an array of packed values that are equal to value
+ * @details see endian::count_n
+ * @param values input
+ * @param n number of elements
+ * @param value value to search for
+ * @return number of matches
+ */
+template <typename T, endian::Order order>
+inline std::size_t count(const Packed<T, order> *values, std::size_t n, T value) noexcept {
+    return endian::count_n<order, T>(values, n, value);
+}
+
+/**
+ * @brief index of the first element of a sorted array of packed values that is not less than value
+ * @details see endian::lower_bound_n
+ * @param values input
+ * @param n number of elements
+ * @param value value to search for
+ * @return index in [0, n]
+ */
+template <typename T, endian::Order order>
+inline std::size_t lower_bound(const Packed<T, order> *values, std::size_t n, T value) noexcept {
+    return endian::lower_bound_n<order, T>(values, n, value);
+}
+
+/**
+ * @brief index of the first element of a sorted array of packed values that is greater than value
+ * @details see endian::upper_bound_n
+ * @param values input
+ * @param n number of elements
+ * @param value value to search for
+ * @return index in [0, n]
+ */
+template <typename T, endian::Order order>
+inline std::size_t upper_bound(const Packed<T, order> *values, std::size_t n, T value) noexcept {
+    return endian::upper_bound_n<order, T>(values, n, value);
+}
+
+/**
+ * @brief select the elements of an array of packed values in the range [lo, hi] (bitmask)
+ * @details see endian::filter_mask_n
+ * @param values input
+ * @param n number of elements
+ * @param lo lower bound (inclusive)
+ * @param hi upper bound (inclusive)
+ * @param mask output ((n + 63) / 64 words)
+ * @return number of selected elements
+ */
+template <typename T, endian::Order order>
+inline std::size_t
+        filter_mask(const Packed<T, order> *values, std::size_t n, T lo, T hi, std::uint64_t *mask) noexcept {
+    return endian::filter_mask_n<order, T>(values, n, lo, hi, mask);
+}
+
+/**
+ * @brief select the elements of an array of packed values in the range [lo, hi] (index list)
+ * @details see endian::filter_index_n
+ * @param values input
+ * @param n number of elements
+ * @param lo lower bound (inclusive)
+ * @param hi upper bound (inclusive)
+ * @param indices output (space for n indices)
+ * @return number of selected elements
+ */
+template <typename T, endian::Order order>
+inline std::size_t
+        filter_index(const Packed<T, order> *values, std::size_t n, T lo, T hi, std::size_t *indices) noexcept {
+    return endian::filter_index_n<order, T>(values, n, lo, hi, indices);
+}
+
+}  // namespace cxxendian
@@ -0,0 +1,385 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus >= 202002L && defined(__has_include)
+#    if __has_include(<span>)
+#        include <span>
+#    endif
+#endif
+
+#include "bulk.hpp"
+#include "endian.hpp"
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace cxxendian {
+
+/**
+ * @brief growing byte buffer that serializes values in a fixed byte order
+ * @details
+ * put appends a value and checks the capacity with a single comparison. The buffer grows geometrically (at least
+ * doubles), so the cost of growing is amortized. If the size of a message is known (or can be bounded) in advance,
+ * reserve it once and use put_unchecked in the hot loop.
+ *
+ * put_n converts whole arrays with the bulk kernels (see bulk.hpp).
+ *
+ * Example:
+ * @code
+ * cxxendian::BE_Writer w;
+ * w.reserve(2 + 4 + n * sizeof(float));
+ * w.put_unchecked<uint16_t>(type);
+ * w.put_unchecked<uint32_t>(n);
+ * w.put_n(samples, n);
+ * send(fd, w.data(), w.size(), 0);
+ * @endcode
+ *
+ * @tparam order byte order of the serialized data
+ * @tparam Allocator allocator that provides the memory (rebound to std::uint8_t)
+ */
+template <endian::Order order, typename Allocator = std::allocator<std::uint8_t>>
+class Writer {
+    using Alloc        = typename std::allocator_traits<Allocator>::template rebind_alloc<std::uint8_t>;
+    using Alloc_Traits = std::allocator_traits<Alloc>;
+
+    //* minimum capacity after the first allocation
+    static constexpr std::size_t MIN_CAPACITY = 64;
+
+    Alloc         alloc;
+    std::uint8_t *buf = nullptr;
+    std::size_t   len = 0;
+    std::size_t   cap = 0;
+
+    void release() noexcept {
+        if (buf) Alloc_Traits::deallocate(alloc, buf, cap);
+        buf = nullptr;
+        cap = 0;
+    }
+
+#if defined(__GNUC__) || defined(__clang__)
+    __attribute__((noinline, cold))
+#endif
+    void grow(std::size_t bytes) {
+        std::size_t new_cap = cap * 2;
+        if (new_cap < len + bytes) new_cap = len + bytes;
+        if (new_cap < MIN_CAPACITY) new_cap = MIN_CAPACITY;
+
+        std::uint8_t *new_buf = Alloc_Traits::allocate(alloc, new_cap);
+        if (len) std::memcpy(new_buf, buf, len);
+        release();
+        buf = new_buf;
+        cap = new_cap;
+    }
+
+public:
+    //* byte order of the serialized data
+    static constexpr endian::Order byte_order = order;
+
+    /**
+     * @brief create empty writer (no allocation)
+     * @param a allocator
+     */
+    explicit Writer(const Allocator &a = Allocator()) noexcept : alloc(a) {}
+
+    /**
+     * @brief create writer with initial capacity
+     * @param capacity initial capacity in bytes
+     * @param a allocator
+     * @exception std::bad_alloc allocation failed (or any exception of the allocator)
+     */
+    explicit Writer(std::size_t capacity, const Allocator &a = Allocator()) : alloc(a) { reserve(capacity); }
+
+    Writer(const Writer &)            = delete;
+    Writer &operator=(const Writer &) = delete;
+
+    /**
+     * @brief move constructor
+     * @param other other instance (empty afterwards)
+     */
+    Writer(Writer &&other) noexcept
+            : alloc(std::move(other.alloc)),
+              buf(std::exchange(other.buf, nullptr)),
+              len(std::exchange(other.len, 0)),
+              cap(std::exchange(other.cap, 0)) {}
+
+    /**
+     * @brief move assignment
+     * @details requires an allocator that propagates on move assignment or compares equal
+     * @param other other instance (empty afterwards)
+     * @return this instance
+     */
+    Writer &operator=(Writer &&other) noexcept {
+        if (this != &other) {
+            release();
+            if constexpr (Alloc_Traits::propagate_on_container_move_assignment::value) alloc = std::move(other.alloc);
+            buf = std::exchange(other.buf, nullptr);
+            len = std::exchange(other.len, 0);
+            cap = std::exchange(other.cap, 0);
+        }
+        return *this;
+    }
+
+    //* free buffer
+    ~Writer() { release(); }
+
+    /**
+     * @brief make sure that at least bytes more bytes can be written without growing
+     * @param bytes number of bytes
+     * @exception std::bad_alloc allocation failed (or any exception of the allocator)
+     */
+    inline void reserve(std::size_t bytes) {
+        if (cap - len < bytes) grow(bytes);
+    }
+
+    /**
+     * @brief append value
+     * @tparam T base data type (integer or floating point)
+     * @param v value in host byte order
+     * @exception std::bad_alloc allocation failed (or any exception of the allocator)
+     */
+    template <typename T>
+    inline void put(T v) {
+        static_assert(std::is_arithmetic<T>::value, "put requires an integer or floating point type");
+        reserve(sizeof(T));
+        put_unchecked(v);
+    }
+
+    /**
+     * @brief append value without checking the capacity
+     * @details The space must have been reserved (see reserve).
+     * @tparam T base data type (integer or floating point)
+     * @param v value in host byte order
+     */
+    template <typename T>
+    inline void put_unchecked(T v) noexcept {
+        static_assert(std::is_arithmetic<T>::value, "put requires an integer or floating point type");
+        assert(cap - len >= sizeof(T));
+        endian::detail::store<order>(buf + len, v);
+        len += sizeof(T);
+    }
+
+    /**
+     * @brief append array
+     * @tparam T base data type (integer or floating point)
+     * @param src values in host byte order
+     * @param n number of values
+     * @exception std::bad_alloc allocation failed (or any exception of the allocator)
+     */
+    template <typename T>
+    inline void put_n(const T *src, std::size_t n) {
+        static_assert(std::is_arithmetic<T>::value, "put_n requires an integer or floating point type");
+        reserve(n * sizeof(T));
+        endian::from_host_n<order>(src, buf + len, n);
+        len += n * sizeof(T);
+    }
+
+    /**
+     * @brief append bytes as they are (e.g. strings or already serialized data)
+     * @param src bytes
+     * @param bytes number of bytes
+     * @exception std::bad_alloc allocation failed (or any exception of the allocator)
+     */
+    inline void put_bytes(const void *src, std::size_t bytes) {
+        reserve(bytes);
+        if (bytes) std::memcpy(buf + len, src, bytes);
+        len += bytes;
+    }
+
+    /**
+     * @brief overwrite a value that was already written (e.g. a length field)
+     * @tparam T base data type (integer or floating point)
+     * @param offset offset of the value in bytes (offset + sizeof(T) <= size())
+     * @param v value in host byte order
+     */
+    template <typename T>
+    inline void patch(std::size_t offset, T v) noexcept {
+        static_assert(std::is_arithmetic<T>::value, "patch requires an integer or floating point type");
+        assert(offset + sizeof(T) <= len);
+        endian::detail::store<order>(buf + offset, v);
+    }
+
+    //* remove all data (the capacity is kept)
+    inline void clear() noexcept { len = 0; }
+
+    //* serialized data
+    inline const std::uint8_t *data() const noexcept { return buf; }
+
+    //* number of serialized bytes
+    inline std::size_t size() const noexcept { return len; }
+
+    //* capacity in bytes
+    inline std::size_t capacity() const noexcept { return cap; }
+
+    //* allocator
+    inline Alloc get_allocator() const noexcept { return alloc; }
+};
+
+/**
+ * @brief cursor that deserializes values in a fixed byte order from a byte buffer
+ * @details
+ * The reader does not own the buffer. If a read exceeds the end of the buffer, the read returns a value initialized
+ * result, all following reads fail as well and ok() returns false. It is therefore sufficient to check ok() once after
+ * a message was parsed.
+ *
+ * If the size of a message part is known in advance, check it once with require and use get_unchecked.
+ *
+ * Example:
+ * @code
+ * cxxendian::BE_Reader r(buffer, n);
+ * const auto type  = r.get<uint16_t>();
+ * const auto count = r.get<uint32_t>();
+ * if (!r.require(count * sizeof(float))) return false;
+ * r.get_n(samples, count);
+ * return r.ok();
+ * @endcode
+ *
+ * @tparam order byte order of the serialized data
+ */
+template <endian::Order order>
+class Reader {
+    const std::uint8_t *pos;
+    const std::uint8_t *end;
+    bool                failed = false;
+
+    void fail() noexcept {
+        pos    = end;
+        failed = true;
+    }
+
+public:
+    //* byte order of the serialized data
+    static constexpr endian::Order byte_order = order;
+
+    /**
+     * @brief create reader
+     * @param data buffer
+     * @param size size of the buffer in bytes
+     */
+    Reader(const void *data, std::size_t size) noexcept
+            : pos(static_cast<const std::uint8_t *>(data)), end(pos + size) {}
+
+#if defined(__cpp_lib_span)
+    /**
+     * @brief create reader
+     * @param data buffer
+     */
+    explicit Reader(std::span<const std::byte> data) noexcept : Reader(data.data(), data.size()) {}
+#endif
+
+    /**
+     * @brief check that at least bytes more bytes are available
+     * @details Fails the reader if not.
+     * @param bytes number of bytes
+     * @return true if available
+     */
+    inline bool require(std::size_t bytes) noexcept {
+        if (remaining() >= bytes) return true;
+        fail();
+        return false;
+    }
+
+    /**
+     * @brief read value
+     * @tparam T base data type (integer or floating point)
+     * @return value in host byte order or T() if the buffer is exhausted
+     */
+    template <typename T>
+    inline T get() noexcept {
+        static_assert(std::is_arithmetic<T>::value, "get requires an integer or floating point type");
+        if (!require(sizeof(T))) return T();
+        return get_unchecked<T>();
+    }
+
+    /**
+     * @brief read value without checking the size
+     * @details The bytes must have been checked with require.
+     * @tparam T base data type (integer or floating point)
+     * @return value in host byte order
+     */
+    template <typename T>
+    inline T get_unchecked() noexcept {
+        static_assert(std::is_arithmetic<T>::value, "get requires an integer or floating point type");
+        assert(remaining() >= sizeof(T));
+        const T v = endian::detail::load<order, T>(pos);
+        pos += sizeof(T);
+        return v;
+    }
+
+    /**
+     * @brief read array
+     * @tparam T base data type (integer or floating point)
+     * @param dst values in host byte order
+     * @param n number of values
+     * @return true on success, false if the buffer is exhausted (dst is not modified)
+     */
+    template <typename T>
+    inline bool get_n(T *dst, std::size_t n) noexcept {
+        static_assert(std::is_arithmetic<T>::value, "get_n requires an integer or floating point type");
+        if (n > remaining() / sizeof(T)) {
+            fail();
+            return false;
+        }
+        endian::to_host_n<order>(pos, dst, n);
+        pos += n * sizeof(T);
+        return true;
+    }
+
+    /**
+     * @brief read bytes as they are
+     * @param dst destination
+     * @param bytes number of bytes
+     * @return true on success, false if the buffer is exhausted (dst is not modified)
+     */
+    inline bool get_bytes(void *dst, std::size_t bytes) noexcept {
+        if (!require(bytes)) return false;
+        if (bytes) std::memcpy(dst, pos, bytes);
+        pos += bytes;
+        return true;
+    }
+
+    /**
+     * @brief skip bytes
+     * @param bytes number of bytes
+     * @return true on success, false if the buffer is exhausted
+     */
+    inline bool skip(std::size_t bytes) noexcept {
+        if (!require(bytes)) return false;
+        pos += bytes;
+        return true;
+    }
+
+    //* false if a read exceeded the buffer
+    inline bool ok() const noexcept { return !failed; }
+
+    //* number of bytes that are not read yet
+    inline std::size_t remaining() const noexcept { return static_cast<std::size_t>(end - pos); }
+
+    //* current read position
+    inline const std::uint8_t *data() const noexcept { return pos; }
+};
+
+//* big endian writer (default allocator)
+using BE_Writer = Writer<endian::Order::Big>;
+
+//* little endian writer (default allocator)
+using LE_Writer = Writer<endian::Order::Little>;
+
+//* big endian reader
+using BE_Reader = Reader<endian::Order::Big>;
+
+//* little endian reader
+using LE_Reader = Reader<endian::Order::Little>;
+
+}  // namespace cxxendian
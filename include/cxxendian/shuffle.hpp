@@ -0,0 +1,315 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "bulk.hpp"
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace endian {
+
+namespace detail {
+
+template <std::size_t W>
+constexpr void check_plane_width() noexcept {
+    static_assert(W == 2 || W == 4 || W == 8 || W == 16, "byte planes require an element width of 2, 4, 8 or 16 bytes");
+}
+
+/**
+ * @brief byte of an element (in byte order from) that is stored in byte plane k (planes in byte order planes)
+ * @details The mapping is its own inverse: byte plane_byte(k) of an element belongs to plane k.
+ */
+template <Order from, Order planes, std::size_t W>
+constexpr std::size_t plane_byte(std::size_t k) noexcept {
+    return from == planes ? k : W - 1 - k;
+}
+
+template <Order from, Order planes, std::size_t W>
+inline void split_planes_scalar(const std::uint8_t *src, std::uint8_t *dst, std::size_t begin, std::size_t n) noexcept {
+    for (std::size_t k = 0; k < W; ++k) {
+        const std::uint8_t *s     = src + plane_byte<from, planes, W>(k);
+        std::uint8_t       *plane = dst + k * n;
+        for (std::size_t i = begin; i < n; ++i)
+            plane[i] = s[i * W];
+    }
+}
+
+template <Order planes, Order to, std::size_t W>
+inline void merge_planes_scalar(const std::uint8_t *src, std::uint8_t *dst, std::size_t begin, std::size_t n) noexcept {
+    for (std::size_t k = 0; k < W; ++k) {
+        const std::uint8_t *plane = src + k * n;
+        std::uint8_t       *d     = dst + plane_byte<to, planes, W>(k);
+        for (std::size_t i = begin; i < n; ++i)
+            d[i * W] = plane[i];
+    }
+}
+
+#if defined(CXXENDIAN_HAVE_SSSE3)
+/**
+ * @brief byte shuffle mask: the 16 / W elements of a vector to W lanes of 16 / W bytes (one lane per plane)
+ */
+template <Order from, Order planes, std::size_t W>
+inline __m128i split_mask() noexcept {
+    constexpr std::size_t L = 16 / W;
+    alignas(16) std::uint8_t m[16];
+    for (std::size_t k = 0; k < W; ++k)
+        for (std::size_t e = 0; e < L; ++e)
+            m[k * L + e] = static_cast<std::uint8_t>(e * W + plane_byte<from, planes, W>(k));
+    return _mm_load_si128(reinterpret_cast<const __m128i *>(m));
+}
+
+//* inverse of split_mask
+template <Order planes, Order to, std::size_t W>
+inline __m128i merge_mask() noexcept {
+    constexpr std::size_t L = 16 / W;
+    alignas(16) std::uint8_t m[16];
+    for (std::size_t k = 0; k < W; ++k)
+        for (std::size_t e = 0; e < L; ++e)
+            m[e * W + plane_byte<to, planes, W>(k)] = static_cast<std::uint8_t>(k * L + e);
+    return _mm_load_si128(reinterpret_cast<const __m128i *>(m));
+}
+
+/**
+ * @brief 128 bit byte plane operations: blocks of 16 elements, one vector per plane
+ */
+struct Ssse3_Planes {
+    using V = __m128i;
+
+    static constexpr std::size_t BLOCK = 16;
+
+    //* vector j of a block of W byte elements
+    template <std::size_t W>
+    static V load_row(const std::uint8_t *p, std::size_t j) noexcept {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 16 * j));
+    }
+    template <std::size_t W>
+    static void store_row(std::uint8_t *p, std::size_t j, V v) noexcept {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(p + 16 * j), v);
+    }
+    static V    load(const std::uint8_t *p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+    static void store(std::uint8_t *p, V v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v); }
+    static V    mask(__m128i m) noexcept { return m; }
+    static V    shuffle(V v, V m) noexcept { return _mm_shuffle_epi8(v, m); }
+
+    //* interleave the lower/upper halves of a and b in units of L bytes
+    template <std::size_t L>
+    static V unpacklo(V a, V b) noexcept {
+        if constexpr (L == 1) return _mm_unpacklo_epi8(a, b);
+        else if constexpr (L == 2) return _mm_unpacklo_epi16(a, b);
+        else if constexpr (L == 4) return _mm_unpacklo_epi32(a, b);
+        else return _mm_unpacklo_epi64(a, b);
+    }
+    template <std::size_t L>
+    static V unpackhi(V a, V b) noexcept {
+        if constexpr (L == 1) return _mm_unpackhi_epi8(a, b);
+        else if constexpr (L == 2) return _mm_unpackhi_epi16(a, b);
+        else if constexpr (L == 4) return _mm_unpackhi_epi32(a, b);
+        else return _mm_unpackhi_epi64(a, b);
+    }
+};
+#endif
+
+#if defined(CXXENDIAN_HAVE_AVX2)
+/**
+ * @brief 256 bit byte plane operations: blocks of 32 elements
+ * @details
+ * The 128 bit lanes hold two independent blocks of 16 elements (the unpack instructions do not cross lanes). After the
+ * transposition, the two lanes of a plane vector are consecutive bytes of the plane.
+ */
+struct Avx2_Planes {
+    using V = __m256i;
+
+    static constexpr std::size_t BLOCK = 32;
+
+    template <std::size_t W>
+    static V load_row(const std::uint8_t *p, std::size_t j) noexcept {
+        const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 16 * j));
+        const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 16 * W + 16 * j));
+        return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    }
+    template <std::size_t W>
+    static void store_row(std::uint8_t *p, std::size_t j, V v) noexcept {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(p + 16 * j), _mm256_castsi256_si128(v));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(p + 16 * W + 16 * j), _mm256_extracti128_si256(v, 1));
+    }
+    static V load(const std::uint8_t *p) noexcept {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    }
+    static void store(std::uint8_t *p, V v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+    static V    mask(__m128i m) noexcept { return _mm256_broadcastsi128_si256(m); }
+    static V    shuffle(V v, V m) noexcept { return _mm256_shuffle_epi8(v, m); }
+
+    template <std::size_t L>
+    static V unpacklo(V a, V b) noexcept {
+        if constexpr (L == 1) return _mm256_unpacklo_epi8(a, b);
+        else if constexpr (L == 2) return _mm256_unpacklo_epi16(a, b);
+        else if constexpr (L == 4) return _mm256_unpacklo_epi32(a, b);
+        else return _mm256_unpacklo_epi64(a, b);
+    }
+    template <std::size_t L>
+    static V unpackhi(V a, V b) noexcept {
+        if constexpr (L == 1) return _mm256_unpackhi_epi8(a, b);
+        else if constexpr (L == 2) return _mm256_unpackhi_epi16(a, b);
+        else if constexpr (L == 4) return _mm256_unpackhi_epi32(a, b);
+        else return _mm256_unpackhi_epi64(a, b);
+    }
+};
+#endif
+
+#if defined(CXXENDIAN_HAVE_SSSE3)
+/**
+ * @brief one interleave round of the lane transposition: r'[2i] = lo(r[i], r[i + W / 2]), r'[2i + 1] = hi(...)
+ * @details expanded at compile time (the vectors stay in registers without relying on loop unrolling)
+ */
+template <typename Ops, std::size_t W, std::size_t... I>
+inline void interleave_lanes(typename Ops::V *r, std::index_sequence<I...>) noexcept {
+    constexpr std::size_t L    = 16 / W;
+    const typename Ops::V t[W] = {(I % 2 ? Ops::template unpackhi<L>(r[I / 2], r[I / 2 + W / 2])
+                                         : Ops::template unpacklo<L>(r[I / 2], r[I / 2 + W / 2]))...};
+    ((r[I] = t[I]), ...);
+}
+
+/**
+ * @brief transpose W x W lanes of 16 / W bytes (per 128 bit lane)
+ * @details log2(W) rounds of the same interleave
+ */
+template <typename Ops, std::size_t W, std::size_t ROUNDS = W>
+inline void transpose_lanes(typename Ops::V *r) noexcept {
+    if constexpr (ROUNDS > 1) {
+        interleave_lanes<Ops, W>(r, std::make_index_sequence<W>());
+        transpose_lanes<Ops, W, ROUNDS / 2>(r);
+    }
+}
+
+template <typename Ops, bool SHUFFLE, std::size_t W, std::size_t... J>
+inline void split_block(const std::uint8_t *src,
+                        std::uint8_t       *dst,
+                        std::size_t         n,
+                        typename Ops::V     mask,
+                        std::index_sequence<J...>) noexcept {
+    typename Ops::V r[W] = {Ops::template load_row<W>(src, J)...};
+    if constexpr (SHUFFLE) ((r[J] = Ops::shuffle(r[J], mask)), ...);
+    transpose_lanes<Ops, W>(r);
+    (Ops::store(dst + J * n, r[J]), ...);
+}
+
+template <typename Ops, bool SHUFFLE, std::size_t W, std::size_t... J>
+inline void merge_block(const std::uint8_t *src,
+                        std::uint8_t       *dst,
+                        std::size_t         n,
+                        typename Ops::V     mask,
+                        std::index_sequence<J...>) noexcept {
+    typename Ops::V r[W] = {Ops::load(src + J * n)...};
+    transpose_lanes<Ops, W>(r);
+    if constexpr (SHUFFLE) ((r[J] = Ops::shuffle(r[J], mask)), ...);
+    (Ops::template store_row<W>(dst, J, r[J]), ...);
+}
+
+/**
+ * @brief split complete blocks into byte planes
+ * @return number of elements processed
+ */
+template <typename Ops, Order from, Order planes, std::size_t W>
+inline std::size_t split_planes_vec(const std::uint8_t *src, std::uint8_t *dst, std::size_t n) noexcept {
+    // 16 byte elements in plane order need no byte shuffle
+    constexpr bool SHUFFLE = W != 16 || from != planes;
+    const auto     mask    = Ops::mask(split_mask<from, planes, W>());
+
+    std::size_t i = 0;
+    for (; i + Ops::BLOCK <= n; i += Ops::BLOCK)
+        split_block<Ops, SHUFFLE, W>(src + i * W, dst + i, n, mask, std::make_index_sequence<W>());
+    return i;
+}
+
+/**
+ * @brief merge complete blocks from byte planes
+ * @return number of elements processed
+ */
+template <typename Ops, Order planes, Order to, std::size_t W>
+inline std::size_t merge_planes_vec(const std::uint8_t *src, std::uint8_t *dst, std::size_t n) noexcept {
+    constexpr bool SHUFFLE = W != 16 || to != planes;
+    const auto     mask    = Ops::mask(merge_mask<planes, to, W>());
+
+    std::size_t i = 0;
+    for (; i + Ops::BLOCK <= n; i += Ops::BLOCK)
+        merge_block<Ops, SHUFFLE, W>(src + i, dst + i * W, n, mask, std::make_index_sequence<W>());
+    return i;
+}
+#endif
+
+#if defined(CXXENDIAN_HAVE_AVX2)
+using Plane_Ops = Avx2_Planes;
+#elif defined(CXXENDIAN_HAVE_SSSE3)
+using Plane_Ops = Ssse3_Planes;
+#endif
+
+}  // namespace detail
+
+/**
+ * @brief split an array into byte planes (byte shuffle filter) and change the byte order in the same pass
+ * @details
+ * Plane k holds byte k of every element, with the bytes of an element numbered in byte order planes. Planes of
+ * slowly changing data (e.g. the exponents of floating point values, the upper bytes of counters) contain long runs
+ * of equal bytes and compress much better with general purpose compressors (zstd, LZ4, deflate).
+ *
+ * With from == planes, this is the shuffle filter of Blosc. With from != planes, the byte swap of the elements is
+ * part of the transposition (no separate pass over the data).
+ *
+ * Example:
+ * @code
+ * // little endian samples, planes with the most significant byte first
+ * std::vector<uint8_t> planes(n * 4);
+ * endian::split_planes_n<endian::Order::Little, endian::Order::Big, 4>(samples, planes.data(), n);
+ * @endcode
+ *
+ * @tparam from byte order of the elements in src
+ * @tparam planes byte order in which the planes are numbered
+ * @tparam W element width in bytes (2, 4, 8 or 16)
+ * @param src input (n elements of W bytes, no alignment required)
+ * @param dst output (W planes of n bytes, no alignment required, must not overlap src)
+ * @param n number of elements
+ */
+template <Order from, Order planes, std::size_t W>
+inline void split_planes_n(const void *src, void *dst, std::size_t n) noexcept {
+    detail::check_plane_width<W>();
+    const auto *s = static_cast<const std::uint8_t *>(src);
+    auto       *d = static_cast<std::uint8_t *>(dst);
+
+    std::size_t i = 0;
+#if defined(CXXENDIAN_HAVE_SSSE3)
+    i = detail::split_planes_vec<detail::Plane_Ops, from, planes, W>(s, d, n);
+#endif
+    detail::split_planes_scalar<from, planes, W>(s, d, i, n);
+}
+
+/**
+ * @brief merge byte planes into an array of elements in the given byte order (inverse of split_planes_n)
+ * @tparam planes byte order in which the planes are numbered
+ * @tparam to byte order of the elements in dst
+ * @tparam W element width in bytes (2, 4, 8 or 16)
+ * @param src input (W planes of n bytes, no alignment required)
+ * @param dst output (n elements of W bytes, no alignment required, must not overlap src)
+ * @param n number of elements
+ */
+template <Order planes, Order to, std::size_t W>
+inline void merge_planes_n(const void *src, void *dst, std::size_t n) noexcept {
+    detail::check_plane_width<W>();
+    const auto *s = static_cast<const std::uint8_t *>(src);
+    auto       *d = static_cast<std::uint8_t *>(dst);
+
+    std::size_t i = 0;
+#if defined(CXXENDIAN_HAVE_SSSE3)
+    i = detail::merge_planes_vec<detail::Plane_Ops, planes, to, W>(s, d, n);
+#endif
+    detail::merge_planes_scalar<planes, to, W>(s, d, i, n);
+}
+
+}  // namespace endian
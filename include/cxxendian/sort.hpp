@@ -0,0 +1,329 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "bulk.hpp"
+#include "packed.hpp"
+#include "vec_ops.hpp"
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace endian {
+
+namespace detail {
+
+//* minimum number of elements per thread of a parallel radix sort
+constexpr std::size_t RADIX_MIN_PER_THREAD = std::size_t(1) << 16;
+
+template <typename T>
+constexpr void check_sort_type() noexcept {
+    static_assert(std::is_arithmetic<T>::value, "sorting requires an integer or floating point type");
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+                  "sorting requires a 1, 2, 4 or 8 byte type");
+}
+
+/**
+ * @brief order preserving key of a value
+ * @details The unsigned integer keys have the same order as the values:
+ *  - unsigned integers: unchanged
+ *  - signed integers: sign bit flipped
+ *  - floating point: all bits flipped for negative values, sign bit flipped for positive values
+ */
+template <typename T>
+inline typename Uint_Of<sizeof(T)>::type encode_key(T v) noexcept {
+    using U          = typename Uint_Of<sizeof(T)>::type;
+    constexpr U SIGN = static_cast<U>(U(1) << (8 * sizeof(T) - 1));
+    U           u    = to_bits(v);
+    if constexpr (std::is_floating_point<T>::value) u = (u & SIGN) ? static_cast<U>(~u) : static_cast<U>(u | SIGN);
+    else if constexpr (std::is_signed<T>::value) u = static_cast<U>(u ^ SIGN);
+    return u;
+}
+
+/**
+ * @brief inverse of encode_key
+ */
+template <typename T>
+inline T decode_key(typename Uint_Of<sizeof(T)>::type u) noexcept {
+    using U          = typename Uint_Of<sizeof(T)>::type;
+    constexpr U SIGN = static_cast<U>(U(1) << (8 * sizeof(T) - 1));
+    if constexpr (std::is_floating_point<T>::value) u = (u & SIGN) ? static_cast<U>(u ^ SIGN) : static_cast<U>(~u);
+    else if constexpr (std::is_signed<T>::value) u = static_cast<U>(u ^ SIGN);
+    return from_bits<T>(u);
+}
+
+/**
+ * @brief run f(t) for t in [0, threads); f(0) runs in the calling thread
+ * @exception std::system_error failed to start a thread (the threads that were started are joined)
+ */
+template <typename F>
+inline void parallel_for(unsigned threads, const F &f) {
+    if (threads <= 1) {
+        f(0u);
+        return;
+    }
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    try {
+        for (unsigned t = 1; t < threads; ++t)
+            workers.emplace_back([&f, t] { f(t); });
+        f(0u);
+    } catch (...) {
+        // destroying a joinable std::thread calls std::terminate: wait for the started workers before rethrowing
+        for (auto &w : workers)
+            w.join();
+        throw;
+    }
+    for (auto &w : workers)
+        w.join();
+}
+
+//* element of a wire order array (moved as raw bytes)
+template <std::size_t W>
+struct Raw_Element {
+    std::uint8_t bytes[W];
+};
+
+//* order preserving key of a wire order element
+template <Order order, typename T>
+struct Wire_Key {
+    typename Uint_Of<sizeof(T)>::type operator()(const Raw_Element<sizeof(T)> &e) const noexcept {
+        return encode_key(load<order, T>(e.bytes));
+    }
+};
+
+//* key and original index of an element (permutation sort)
+template <typename U>
+struct Keyed_Index {
+    U           key;
+    std::size_t index;
+};
+
+//* key of a Keyed_Index
+struct Index_Key {
+    template <typename U>
+    U operator()(const Keyed_Index<U> &e) const noexcept {
+        return e.key;
+    }
+};
+
+/**
+ * @brief stable LSD radix sort of records by 8 bit digits
+ * @details
+ * The histograms of all digits are computed in one pass over the data. Passes in which all records have the same
+ * digit are skipped. With threads > 1, the data is split into one chunk per thread. Every thread counts the digits of
+ * its chunk and scatters its chunk to offsets that keep the order of the chunks (the sort stays stable).
+ * @param data records (sorted on return)
+ * @param scratch space for n records
+ * @param n number of records
+ * @param key key(record): unsigned integer key of a record
+ * @param threads number of threads
+ */
+template <typename Record, typename Key>
+inline void lsd_sort(Record *data, Record *scratch, std::size_t n, const Key &key, unsigned threads) {
+    using Histogram              = std::array<std::size_t, 256>;
+    constexpr std::size_t digits = sizeof(key(*data));
+    const auto            digit  = [&key](const Record &r, std::size_t j) {
+        return static_cast<std::size_t>((key(r) >> (8 * j)) & 0xFFu);
+    };
+
+    threads = static_cast<unsigned>(std::max<std::size_t>(1, std::min<std::size_t>(threads, n / RADIX_MIN_PER_THREAD)));
+    const std::size_t chunk = (n + threads - 1) / threads;
+    const auto        first = [&](unsigned t) { return std::min(n, t * chunk); };
+
+    // histograms of all digits for every chunk
+    std::vector<Histogram> counts(std::size_t(threads) * digits, Histogram {});
+    parallel_for(threads, [&](unsigned t) {
+        Histogram *c = counts.data() + std::size_t(t) * digits;
+        for (std::size_t i = first(t); i < first(t + 1); ++i) {
+            const auto k = key(data[i]);
+            for (std::size_t j = 0; j < digits; ++j)
+                ++c[j][(k >> (8 * j)) & 0xFFu];
+        }
+    });
+
+    std::vector<Histogram> chunk_counts(threads);
+    std::vector<Histogram> offsets(threads);
+    Record                *src      = data;
+    Record                *dst      = scratch;
+    bool                   permuted = false;
+    for (std::size_t j = 0; j < digits; ++j) {
+        Histogram total {};
+        for (unsigned t = 0; t < threads; ++t)
+            for (std::size_t d = 0; d < 256; ++d)
+                total[d] += counts[std::size_t(t) * digits + j][d];
+        if (std::find(total.begin(), total.end(), n) != total.end()) continue;  // all records have the same digit
+
+        // the chunk histograms of the first pass are still valid, later passes operate on permuted data
+        if (!permuted) {
+            for (unsigned t = 0; t < threads; ++t)
+                chunk_counts[t] = counts[std::size_t(t) * digits + j];
+        } else if (threads > 1) {
+            parallel_for(threads, [&](unsigned t) {
+                chunk_counts[t].fill(0);
+                for (std::size_t i = first(t); i < first(t + 1); ++i)
+                    ++chunk_counts[t][digit(src[i], j)];
+            });
+        } else {
+            chunk_counts[0] = total;
+        }
+
+        std::size_t running = 0;
+        for (std::size_t d = 0; d < 256; ++d) {
+            for (unsigned t = 0; t < threads; ++t) {
+                offsets[t][d] = running;
+                running += chunk_counts[t][d];
+            }
+        }
+
+        parallel_for(threads, [&](unsigned t) {
+            Histogram &o = offsets[t];
+            for (std::size_t i = first(t); i < first(t + 1); ++i)
+                dst[o[digit(src[i], j)]++] = src[i];
+        });
+        std::swap(src, dst);
+        permuted = true;
+    }
+    if (src != data) std::copy(src, src + n, data);
+}
+
+}  // namespace detail
+
+/**
+ * @brief sort an array in the given byte order
+ * @details
+ * Stable LSD radix sort over the bytes of the order preserving key (see to_sort_keys_n). The keys are computed from
+ * the wire order data, the elements are moved as raw bytes and never converted. Floating point values are sorted
+ * by the total order -NaN < -inf < ... < -0.0 < 0.0 < ... < inf < NaN.
+ *
+ * Example:
+ * @code
+ * endian::radix_sort_n<endian::Order::Big, uint64_t>(index_file, entries, std::thread::hardware_concurrency());
+ * @endcode
+ *
+ * @tparam order byte order of data
+ * @tparam T data type of the elements
+ * @param data array (n elements of type T in byte order order, no alignment required). Sorted in ascending order on
+ * return.
+ * @param n number of elements
+ * @param threads number of threads for the histogram and scatter passes (at most one per 64 Ki elements is used)
+ * @exception std::bad_alloc failed to allocate the scratch buffer (n elements)
+ * @exception std::system_error failed to start a thread
+ */
+template <Order order, typename T>
+inline void radix_sort_n(void *data, std::size_t n, unsigned threads = 1) {
+    detail::check_sort_type<T>();
+    if (n < 2) return;
+    using E = detail::Raw_Element<sizeof(T)>;
+    std::unique_ptr<E[]> scratch(new E[n]);
+    detail::lsd_sort(static_cast<E *>(data), scratch.get(), n, detail::Wire_Key<order, T>(), threads);
+}
+
+/**
+ * @brief sorting permutation of an array in the given byte order
+ * @details
+ * Computes the permutation that sorts the array without moving the elements: src[permutation[0]],
+ * src[permutation[1]], ... is in ascending order. Equal elements keep their relative order. See radix_sort_n.
+ * @tparam order byte order of src
+ * @tparam T data type of the elements
+ * @param src input (n elements of type T in byte order order, no alignment required)
+ * @param n number of elements
+ * @param permutation output (n indices)
+ * @param threads number of threads for the histogram and scatter passes (at most one per 64 Ki elements is used)
+ * @exception std::bad_alloc failed to allocate the key buffers (2 * n keys and indices)
+ * @exception std::system_error failed to start a thread
+ */
+template <Order order, typename T>
+inline void radix_sort_index_n(const void *src, std::size_t n, std::size_t *permutation, unsigned threads = 1) {
+    detail::check_sort_type<T>();
+    using K = detail::Keyed_Index<typename detail::Uint_Of<sizeof(T)>::type>;
+
+    const auto         *s = static_cast<const std::uint8_t *>(src);
+    std::unique_ptr<K[]> keys(new K[2 * n]);
+    for (std::size_t i = 0; i < n; ++i)
+        keys[i] = K {detail::encode_key(detail::load<order, T>(s + i * sizeof(T))), i};
+    detail::lsd_sort(keys.get(), keys.get() + n, n, detail::Index_Key(), threads);
+    for (std::size_t i = 0; i < n; ++i)
+        permutation[i] = keys[i].index;
+}
+
+/**
+ * @brief encode host values as order preserving sort keys
+ * @details
+ * Every value is written as sizeof(T) big endian bytes. Comparing two keys with memcmp gives the same order as
+ * comparing the values (floating point: -NaN < -inf < ... < -0.0 < 0.0 < ... < inf < NaN). Keys of composite sort
+ * criteria can be concatenated. Unsigned big endian integers are already valid keys.
+ * @tparam T data type
+ * @param src input
+ * @param dst output (n * sizeof(T) bytes)
+ * @param n number of values
+ */
+template <typename T>
+inline void to_sort_keys_n(const T *src, void *dst, std::size_t n) noexcept {
+    detail::check_sort_type<T>();
+    auto *d = static_cast<std::uint8_t *>(dst);
+    for (std::size_t i = 0; i < n; ++i) {
+        detail::store<Order::Big>(d + i * sizeof(T), detail::encode_key(src[i]));
+    }
+}
+
+/**
+ * @brief decode order preserving sort keys
+ * @details inverse of to_sort_keys_n
+ * @tparam T data type
+ * @param src input (n * sizeof(T) bytes)
+ * @param dst output
+ * @param n number of values
+ */
+template <typename T>
+inline void from_sort_keys_n(const void *src, T *dst, std::size_t n) noexcept {
+    detail::check_sort_type<T>();
+    using U       = typename detail::Uint_Of<sizeof(T)>::type;
+    const auto *s = static_cast<const std::uint8_t *>(src);
+    for (std::size_t i = 0; i < n; ++i)
+        dst[i] = detail::decode_key<T>(detail::load<Order::Big, U>(s + i * sizeof(T)));
+}
+
+}  // namespace endian
+
+namespace cxxendian {
+
+/**
+ * @brief sort an array of packed values
+ * @details see endian::radix_sort_n
+ * @param values array (sorted in ascending order on return)
+ * @param n number of elements
+ * @param threads number of threads
+ */
+template <typename T, endian::Order order>
+inline void radix_sort(Packed<T, order> *values, std::size_t n, unsigned threads = 1) {
+    endian::radix_sort_n<order, T>(values, n, threads);
+}
+
+/**
+ * @brief sorting permutation of an array of packed values
+ * @details see endian::radix_sort_index_n
+ * @param values input
+ * @param n number of elements
+ * @param permutation output (n indices)
+ * @param threads number of threads
+ */
+template <typename T, endian::Order order>
+inline void radix_sort_index(const Packed<T, order> *values, std::size_t n, std::size_t *permutation,
+                             unsigned threads = 1) {
+    endian::radix_sort_index_n<order, T>(values, n, permutation, threads);
+}
+
+}  // namespace cxxendian
@@ -0,0 +1,312 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+#    include <sys/mman.h>
+#endif
+
+#include "bulk.hpp"
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace endian {
+
+/**
+ * @brief parameters of the streaming bulk conversion
+ * @details The optimal values depend on the memory subsystem of the host. Use calibrate_stream to determine them and
+ * store the result per host type.
+ */
+struct Stream_Params {
+    //* distance in bytes between the current read position and the software prefetches (0: no prefetch)
+    std::size_t prefetch_distance = 2048;
+    //* number of bytes that are converted between two prefetch rounds
+    std::size_t block_bytes = 4096;
+    //* write the output with non-temporal stores
+    bool non_temporal = true;
+};
+
+namespace detail {
+
+inline void prefetch(const void *p) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p, 0, 0);
+#elif defined(CXXENDIAN_HAVE_SSE2)
+    _mm_prefetch(static_cast<const char *>(p), _MM_HINT_NTA);
+#else
+    static_cast<void>(p);
+#endif
+}
+
+/**
+ * @brief streaming byte swap of n elements with W bytes each
+ * @details Converts block_bytes at once. Before each block, the block that is prefetch_distance bytes ahead is
+ * prefetched (one prefetch per 64 byte cache line). The elements before the first cache line aligned output address
+ * are converted first, so every block starts aligned and needs no prologue. The non-temporal stores of all blocks are
+ * fenced once at the end.
+ */
+template <std::size_t W, bool SWAP>
+inline void swap_bytes_stream(const void *src, void *dst, std::size_t n, const Stream_Params &params) noexcept {
+    constexpr std::size_t CACHE_LINE = 64;
+
+    auto *s = static_cast<const std::uint8_t *>(src);
+    auto *d = static_cast<std::uint8_t *>(dst);
+
+    // align the output of the blocks to a cache line (not possible if the address is not a multiple of W)
+    const std::size_t misalignment = reinterpret_cast<std::uintptr_t>(d) % CACHE_LINE;
+    if (SWAP && misalignment % W == 0) {
+        const std::size_t head = std::min(n, ((CACHE_LINE - misalignment) % CACHE_LINE) / W);
+        swap_scalar<W>(s, d, head);
+        s += head * W;
+        d += head * W;
+        n -= head;
+    }
+    const std::size_t bytes = n * W;
+
+    // whole elements and cache lines per block
+    std::size_t block = std::max(params.block_bytes, CACHE_LINE);
+    block -= block % (CACHE_LINE * W);
+    block = std::max(block, CACHE_LINE * W);
+
+    for (std::size_t i = 0; i < bytes; i += block) {
+        if (params.prefetch_distance) {
+            const std::size_t begin = i + params.prefetch_distance;
+            const std::size_t end   = std::min(begin + block, bytes);
+            for (std::size_t p = begin; p < end; p += CACHE_LINE)
+                prefetch(s + p);
+        }
+
+        const std::size_t m = std::min(block, bytes - i) / W;
+        if constexpr (SWAP) {
+            if (params.non_temporal) swap_bytes_aligned<W, true, false>(s + i, d + i, m);
+            else swap_bytes_aligned<W, false>(s + i, d + i, m);
+        } else {
+            std::memcpy(d + i, s + i, m * W);
+        }
+    }
+
+#if defined(CXXENDIAN_HAVE_SSE2)
+    if (SWAP && params.non_temporal) _mm_sfence();
+#endif
+}
+
+}  // namespace detail
+
+/**
+ * @brief convert a large array (much larger than the last level cache) from the given byte order to host endian
+ * @details Variant of to_host_n with software prefetching and optional non-temporal stores. src and dst must not
+ * overlap.
+ * @tparam order byte order of src
+ * @tparam T data type
+ * @param src input (n elements of type T in byte order order, no alignment required)
+ * @param dst output
+ * @param n number of elements
+ * @param params stream parameters (see calibrate_stream)
+ */
+template <Order order, typename T>
+inline void to_host_stream_n(const void *src, T *dst, std::size_t n, const Stream_Params &params = {}) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value, "to_host_stream_n requires a trivially copyable type");
+    CXXENDIAN_COUNT_BULK(detail::to_host_direction(order), sizeof(T), n);
+    detail::swap_bytes_stream<sizeof(T), order != HostOrder>(src, dst, n, params);
+}
+
+/**
+ * @brief convert a large array (much larger than the last level cache) from host endian to the given byte order
+ * @details Variant of from_host_n with software prefetching and optional non-temporal stores. src and dst must not
+ * overlap.
+ * @tparam order byte order of dst
+ * @tparam T data type
+ * @param src input
+ * @param dst output (n elements of type T in byte order order, no alignment required)
+ * @param n number of elements
+ * @param params stream parameters (see calibrate_stream)
+ */
+template <Order order, typename T>
+inline void from_host_stream_n(const T *src, void *dst, std::size_t n, const Stream_Params &params = {}) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value, "from_host_stream_n requires a trivially copyable type");
+    CXXENDIAN_COUNT_BULK(detail::from_host_direction(order), sizeof(T), n);
+    detail::swap_bytes_stream<sizeof(T), order != HostOrder>(src, dst, n, params);
+}
+
+/**
+ * @brief buffer for large conversion outputs that is backed by huge pages if possible
+ * @details On Linux the memory is mapped with mmap and transparent huge pages are requested with madvise. This
+ * reduces TLB misses when streaming through large arrays. On other systems (or if mmap fails) the buffer is allocated
+ * with 2 MiB alignment.
+ * @tparam T element type
+ */
+template <typename T>
+class Huge_Buffer {
+    static_assert(std::is_trivial<T>::value, "Huge_Buffer requires a trivial type");
+
+    //* alignment (size of a huge page on x86_64 and aarch64)
+    static constexpr std::size_t HUGE_PAGE = std::size_t(2) << 20;
+
+    T          *ptr    = nullptr;
+    std::size_t n      = 0;
+    std::size_t mapped = 0;  // size of the mapping, 0 if allocated with aligned_alloc
+
+    void release() noexcept {
+        if (!ptr) return;
+#if defined(__linux__)
+        if (mapped) {
+            munmap(ptr, mapped);
+            ptr = nullptr;
+            return;
+        }
+#endif
+#if defined(_MSC_VER)
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+        ptr = nullptr;
+    }
+
+public:
+    //* empty buffer
+    Huge_Buffer() noexcept = default;
+
+    /**
+     * @brief allocate buffer
+     * @param size number of elements
+     * @exception std::bad_alloc allocation failed
+     */
+    explicit Huge_Buffer(std::size_t size) : n(size) {
+        if (!size) return;
+        const std::size_t bytes = (size * sizeof(T) + HUGE_PAGE - 1) / HUGE_PAGE * HUGE_PAGE;
+#if defined(__linux__)
+        void *p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p != MAP_FAILED) {
+#    if defined(MADV_HUGEPAGE)
+            madvise(p, bytes, MADV_HUGEPAGE);
+#    endif
+            ptr    = static_cast<T *>(p);
+            mapped = bytes;
+            return;
+        }
+#endif
+#if defined(_MSC_VER)
+        ptr = static_cast<T *>(_aligned_malloc(bytes, HUGE_PAGE));
+#else
+        ptr = static_cast<T *>(std::aligned_alloc(HUGE_PAGE, bytes));
+#endif
+        if (!ptr) throw std::bad_alloc();
+    }
+
+    Huge_Buffer(const Huge_Buffer &)            = delete;
+    Huge_Buffer &operator=(const Huge_Buffer &) = delete;
+
+    /**
+     * @brief move constructor
+     * @param other other instance (empty afterwards)
+     */
+    Huge_Buffer(Huge_Buffer &&other) noexcept
+            : ptr(std::exchange(other.ptr, nullptr)),
+              n(std::exchange(other.n, 0)),
+              mapped(std::exchange(other.mapped, 0)) {}
+
+    /**
+     * @brief move assignment
+     * @param other other instance (empty afterwards)
+     * @return this instance
+     */
+    Huge_Buffer &operator=(Huge_Buffer &&other) noexcept {
+        if (this != &other) {
+            release();
+            ptr    = std::exchange(other.ptr, nullptr);
+            n      = std::exchange(other.n, 0);
+            mapped = std::exchange(other.mapped, 0);
+        }
+        return *this;
+    }
+
+    //* free buffer
+    ~Huge_Buffer() { release(); }
+
+    //* pointer to the first element
+    inline T *data() noexcept { return ptr; }
+
+    //* pointer to the first element
+    inline const T *data() const noexcept { return ptr; }
+
+    //* number of elements
+    inline std::size_t size() const noexcept { return n; }
+
+    //* access element
+    inline T &operator[](std::size_t i) noexcept { return ptr[i]; }
+
+    //* access element
+    inline const T &operator[](std::size_t i) const noexcept { return ptr[i]; }
+};
+
+/**
+ * @brief determine the stream parameters for this host
+ * @details Converts a buffer of calibration_bytes with different prefetch distances (and with/without non-temporal
+ * stores), then tries a few block sizes with the fastest combination and returns the overall fastest parameters.
+ * calibration_bytes should be several times the size of the last level cache. The calibration takes a few hundred
+ * milliseconds with the default size.
+ * @param calibration_bytes size of the test buffer in bytes
+ * @return stream parameters
+ * @exception std::bad_alloc allocation of the test buffers failed
+ */
+inline Stream_Params calibrate_stream(std::size_t calibration_bytes = std::size_t(128) << 20) {
+    constexpr std::size_t DISTANCES[] = {0, 256, 512, 1024, 2048, 4096, 8192, 16384};
+    constexpr std::size_t BLOCKS[]    = {1024, 16384, 65536};  // the default (4096) is covered by the first pass
+    constexpr int         REPEAT      = 2;
+
+    const std::size_t          n = std::max<std::size_t>(calibration_bytes / sizeof(std::uint32_t), 1);
+    Huge_Buffer<std::uint32_t> src(n);
+    Huge_Buffer<std::uint32_t> dst(n);
+    std::memset(src.data(), 0x5A, n * sizeof(std::uint32_t));
+    std::memset(dst.data(), 0, n * sizeof(std::uint32_t));  // fault in pages before timing
+
+    Stream_Params best;
+    auto          best_time = std::chrono::steady_clock::duration::max();
+    auto          measure   = [&](const Stream_Params &params) {
+        auto time = std::chrono::steady_clock::duration::max();
+        for (int r = 0; r < REPEAT; ++r) {
+            const auto start = std::chrono::steady_clock::now();
+            detail::swap_bytes_stream<sizeof(std::uint32_t), true>(src.data(), dst.data(), n, params);
+            time = std::min(time, std::chrono::steady_clock::now() - start);
+        }
+
+        if (time < best_time) {
+            best_time = time;
+            best      = params;
+        }
+    };
+
+    for (bool nt : {true, false}) {
+        for (std::size_t distance : DISTANCES) {
+            Stream_Params params;
+            params.prefetch_distance = distance;
+            params.non_temporal      = nt;
+            measure(params);
+        }
+    }
+
+    const Stream_Params fastest = best;
+    for (std::size_t block : BLOCKS) {
+        Stream_Params params = fastest;
+        params.block_bytes   = block;
+        measure(params);
+    }
+    return best;
+}
+
+}  // namespace endian
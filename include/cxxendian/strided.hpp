@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "bulk.hpp"
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace endian {
+
+namespace detail {
+
+/**
+ * @brief copy one element with W bytes and reverse its bytes if requested
+ */
+template <std::size_t W, bool SWAP>
+inline void copy_one(const std::uint8_t *src, std::uint8_t *dst) noexcept {
+    if constexpr (SWAP) {
+        swap_scalar<W>(src, dst, 1);
+    } else {
+        std::memcpy(dst, src, W);
+    }
+}
+
+/**
+ * @brief strided load of n elements with W bytes each into a contiguous buffer
+ * @details Element i is read from src + i * stride. The AVX2/AVX-512 gather instructions are used for 4 and 8 byte
+ * elements. They read exactly W bytes per element, the scalar loop handles everything else.
+ */
+template <std::size_t W, bool SWAP>
+inline void gather_strided(const std::uint8_t *src, std::size_t stride, std::uint8_t *dst, std::size_t n) noexcept {
+    std::size_t i = 0;
+
+#if defined(CXXENDIAN_HAVE_AVX2) && !defined(CXXENDIAN_NO_GATHER)
+    // gather indices are signed 32 bit values
+    constexpr auto IDX_MAX = static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max());
+    if constexpr (W == 4) {
+#    if defined(CXXENDIAN_HAVE_AVX512)
+        if (stride <= IDX_MAX / 15) {
+            const __m512i idx = _mm512_mullo_epi32(
+                    _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                    _mm512_set1_epi32(static_cast<int>(stride)));
+            for (; i + 16 <= n; i += 16) {
+                __m512i v = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xFFFF, idx, src + i * stride, 1);
+                if constexpr (SWAP) v = swap_vec<4>(v);
+                _mm512_storeu_si512(dst + i * 4, v);
+            }
+        }
+#    endif
+        if (stride <= IDX_MAX / 7) {
+            const __m256i idx = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                                   _mm256_set1_epi32(static_cast<int>(stride)));
+            for (; i + 8 <= n; i += 8) {
+                __m256i v = _mm256_i32gather_epi32(reinterpret_cast<const int *>(src + i * stride), idx, 1);
+                if constexpr (SWAP) v = swap_vec<4>(v);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i * 4), v);
+            }
+        }
+    } else if constexpr (W == 8) {
+        if (stride <= IDX_MAX / 3) {
+            const __m128i idx =
+                    _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(static_cast<int>(stride)));
+            for (; i + 4 <= n; i += 4) {
+                __m256i v = _mm256_i32gather_epi64(reinterpret_cast<const long long *>(src + i * stride), idx, 1);
+                if constexpr (SWAP) v = swap_vec<8>(v);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i * 8), v);
+            }
+        }
+    }
+#endif
+
+    for (; i < n; ++i)
+        copy_one<W, SWAP>(src + i * stride, dst + i * W);
+}
+
+/**
+ * @brief indexed load of n elements with W bytes each into a contiguous buffer
+ * @details Element i is read from base + offsets[i].
+ */
+template <std::size_t W, bool SWAP>
+inline void gather_indexed(const std::uint8_t *base,
+                           const std::int32_t *offsets,
+                           std::uint8_t       *dst,
+                           std::size_t         n) noexcept {
+    std::size_t i = 0;
+
+#if defined(CXXENDIAN_HAVE_AVX2) && !defined(CXXENDIAN_NO_GATHER)
+    if constexpr (W == 4) {
+#    if defined(CXXENDIAN_HAVE_AVX512)
+        for (; i + 16 <= n; i += 16) {
+            const __m512i idx = _mm512_loadu_si512(offsets + i);
+            __m512i       v   = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xFFFF, idx, base, 1);
+            if constexpr (SWAP) v = swap_vec<4>(v);
+            _mm512_storeu_si512(dst + i * 4, v);
+        }
+#    endif
+        for (; i + 8 <= n; i += 8) {
+            const __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(offsets + i));
+            __m256i       v   = _mm256_i32gather_epi32(reinterpret_cast<const int *>(base), idx, 1);
+            if constexpr (SWAP) v = swap_vec<4>(v);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i * 4), v);
+        }
+    } else if constexpr (W == 8) {
+        for (; i + 4 <= n; i += 4) {
+            const __m128i idx = _mm_loadu_si128(reinterpret_cast<const __m128i *>(offsets + i));
+            __m256i       v   = _mm256_i32gather_epi64(reinterpret_cast<const long long *>(base), idx, 1);
+            if constexpr (SWAP) v = swap_vec<8>(v);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i * 8), v);
+        }
+    }
+#endif
+
+    for (; i < n; ++i)
+        copy_one<W, SWAP>(base + offsets[i], dst + i * W);
+}
+
+/**
+ * @brief strided store of n elements with W bytes each from a contiguous buffer
+ * @details Element i is written to dst + i * stride. Bytes between the elements are not modified.
+ */
+template <std::size_t W, bool SWAP>
+inline void scatter_strided(const std::uint8_t *src, std::uint8_t *dst, std::size_t stride, std::size_t n) noexcept {
+    for (std::size_t i = 0; i < n; ++i)
+        copy_one<W, SWAP>(src + i * W, dst + i * stride);
+}
+
+}  // namespace detail
+
+/**
+ * @brief convert every stride bytes one element from the given byte order to host endian (array of structs to
+ * contiguous column)
+ * @details Element i is read from src + i * stride and written to dst[i].
+ *
+ * Example: 4 byte big endian field at offset 8 of 32 byte records
+ * @code
+ * endian::to_host_strided_n<endian::Order::Big>(records + 8, 32, column, n_records);
+ * @endcode
+ *
+ * @tparam order byte order of the input elements
+ * @tparam T data type
+ * @param src address of the first input element (no alignment required)
+ * @param stride distance between two input elements in bytes
+ * @param dst contiguous output
+ * @param n number of elements
+ */
+template <Order order, typename T>
+inline void to_host_strided_n(const void *src, std::size_t stride, T *dst, std::size_t n) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value, "to_host_strided_n requires a trivially copyable type");
+    CXXENDIAN_COUNT_BULK(detail::to_host_direction(order), sizeof(T), n);
+    detail::gather_strided<sizeof(T), order != HostOrder>(
+            static_cast<const std::uint8_t *>(src), stride, reinterpret_cast<std::uint8_t *>(dst), n);
+}
+
+/**
+ * @brief convert elements from host endian to the given byte order and store them every stride bytes (contiguous
+ * column to array of structs)
+ * @details src[i] is written to dst + i * stride. Bytes between the elements are not modified.
+ * @tparam order byte order of the output elements
+ * @tparam T data type
+ * @param src contiguous input
+ * @param dst address of the first output element (no alignment required)
+ * @param stride distance between two output elements in bytes
+ * @param n number of elements
+ */
+template <Order order, typename T>
+inline void from_host_strided_n(const T *src, void *dst, std::size_t stride, std::size_t n) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value, "from_host_strided_n requires a trivially copyable type");
+    CXXENDIAN_COUNT_BULK(detail::from_host_direction(order), sizeof(T), n);
+    detail::scatter_strided<sizeof(T), order != HostOrder>(
+            reinterpret_cast<const std::uint8_t *>(src), static_cast<std::uint8_t *>(dst), stride, n);
+}
+
+/**
+ * @brief gather elements at arbitrary byte offsets and convert them from the given byte order to host endian
+ * @details Element i is read from base + offsets[i] and written to dst[i].
+ * @tparam order byte order of the input elements
+ * @tparam T data type
+ * @param base base address of the input
+ * @param offsets byte offset of each input element relative to base
+ * @param dst contiguous output
+ * @param n number of elements
+ */
+template <Order order, typename T>
+inline void to_host_gather_n(const void *base, const std::int32_t *offsets, T *dst, std::size_t n) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value, "to_host_gather_n requires a trivially copyable type");
+    CXXENDIAN_COUNT_BULK(detail::to_host_direction(order), sizeof(T), n);
+    detail::gather_indexed<sizeof(T), order != HostOrder>(
+            static_cast<const std::uint8_t *>(base), offsets, reinterpret_cast<std::uint8_t *>(dst), n);
+}
+
+/**
+ * @brief convert elements from host endian to the given byte order and scatter them to arbitrary byte offsets
+ * @details src[i] is written to base + offsets[i].
+ * @tparam order byte order of the output elements
+ * @tparam T data type
+ * @param src contiguous input
+ * @param base base address of the output
+ * @param offsets byte offset of each output element relative to base
+ * @param n number of elements
+ */
+template <Order order, typename T>
+inline void from_host_scatter_n(const T *src, void *base, const std::int32_t *offsets, std::size_t n) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value, "from_host_scatter_n requires a trivially copyable type");
+    CXXENDIAN_COUNT_BULK(detail::from_host_direction(order), sizeof(T), n);
+    const auto *s = reinterpret_cast<const std::uint8_t *>(src);
+    auto       *d = static_cast<std::uint8_t *>(base);
+    for (std::size_t i = 0; i < n; ++i)
+        detail::copy_one<sizeof(T), order != HostOrder>(s + i * sizeof(T), d + offsets[i]);
+}
+
+}  // namespace endian
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include "endian.hpp"
+#include "float.hpp"
+#include "int.hpp"
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace cxxendian {
+
+/**
+ * @brief byte order and base data type of an endian type
+ * @details Specialized for LE_*, BE_* and Host_* types. Provides
+ *  - value_type: base data type
+ *  - order: byte order of the stored data
+ * @tparam T endian type
+ */
+template <typename T>
+struct Endian_Traits;
+
+template <typename T>
+struct Endian_Traits<LE_Int<T>> {
+    using value_type                     = T;
+    static constexpr endian::Order order = endian::Order::Little;
+};
+
+template <typename T>
+struct Endian_Traits<BE_Int<T>> {
+    using value_type                     = T;
+    static constexpr endian::Order order = endian::Order::Big;
+};
+
+template <typename T>
+struct Endian_Traits<Host_Int<T>> {
+    using value_type                     = T;
+    static constexpr endian::Order order = endian::HostOrder;
+};
+
+template <typename T>
+struct Endian_Traits<LE_Float<T>> {
+    using value_type                     = T;
+    static constexpr endian::Order order = endian::Order::Little;
+};
+
+template <typename T>
+struct Endian_Traits<BE_Float<T>> {
+    using value_type                     = T;
+    static constexpr endian::Order order = endian::Order::Big;
+};
+
+template <typename T>
+struct Endian_Traits<Host_Float<T>> {
+    using value_type                     = T;
+    static constexpr endian::Order order = endian::HostOrder;
+};
+
+}  // namespace cxxendian
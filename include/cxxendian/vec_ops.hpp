@@ -0,0 +1,336 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "bulk.hpp"
+
+/**
+ * @brief namespace for all members of the cxxendian library
+ */
+namespace endian {
+
+namespace detail {
+
+/**
+ * @brief number of set bits
+ */
+inline unsigned count_bits(std::uint64_t v) noexcept {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__POPCNT__) || !defined(__x86_64__))
+    return static_cast<unsigned>(__builtin_popcountll(v));
+#else
+    // without the popcnt instruction, the builtin is a library call
+    v = v - ((v >> 1) & 0x5555555555555555ULL);
+    v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+    v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<unsigned>((v * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/**
+ * @brief index of the lowest set bit (v must not be 0)
+ */
+inline unsigned lowest_bit(std::uint64_t v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(v));
+#else
+    unsigned n = 0;
+    for (; !(v & 1); v >>= 1)
+        ++n;
+    return n;
+#endif
+}
+
+#if defined(CXXENDIAN_HAVE_SSE2)
+/**
+ * @brief 128 bit vector operations of the reduction and search kernels
+ */
+struct Sse2_Ops {
+    using V = __m128i;
+
+    static constexpr std::size_t BYTES = 16;
+
+    static V load(const std::uint8_t *p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+    static void store(void *p, V v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v); }
+    template <std::size_t W>
+    static V swap(V v) noexcept {
+        return swap_vec<W>(v);
+    }
+
+    static V zero() noexcept { return _mm_setzero_si128(); }
+    static V set1_8(std::int8_t v) noexcept { return _mm_set1_epi8(static_cast<char>(v)); }
+    static V set1_16(std::int16_t v) noexcept { return _mm_set1_epi16(v); }
+    static V set1_32(std::int32_t v) noexcept { return _mm_set1_epi32(v); }
+    static V bxor(V a, V b) noexcept { return _mm_xor_si128(a, b); }
+    static V add32(V a, V b) noexcept { return _mm_add_epi32(a, b); }
+    static V add64(V a, V b) noexcept { return _mm_add_epi64(a, b); }
+    static V sad_u8(V a) noexcept { return _mm_sad_epu8(a, _mm_setzero_si128()); }
+    static V madd16(V a, V b) noexcept { return _mm_madd_epi16(a, b); }
+    static V sign32(V v) noexcept { return _mm_srai_epi32(v, 31); }
+    static V unpacklo32(V a, V b) noexcept { return _mm_unpacklo_epi32(a, b); }
+    static V unpackhi32(V a, V b) noexcept { return _mm_unpackhi_epi32(a, b); }
+    static V unpacklo16(V a, V b) noexcept { return _mm_unpacklo_epi16(a, b); }
+    static V unpackhi16(V a, V b) noexcept { return _mm_unpackhi_epi16(a, b); }
+    static V sign16(V v) noexcept { return _mm_srai_epi16(v, 15); }
+    static V band(V a, V b) noexcept { return _mm_and_si128(a, b); }
+    static V sub64(V a, V b) noexcept { return _mm_sub_epi64(a, b); }
+    static V mul_u32(V a, V b) noexcept { return _mm_mul_epu32(a, b); }
+    static V srli64(V v) noexcept { return _mm_srli_epi64(v, 32); }
+    static V slli64(V v) noexcept { return _mm_slli_epi64(v, 32); }
+    static V hi32_mask() noexcept { return _mm_set1_epi64x(static_cast<long long>(0xFFFFFFFF00000000ULL)); }
+
+    static V ones() noexcept { return _mm_cmpeq_epi32(_mm_setzero_si128(), _mm_setzero_si128()); }
+    static V bor(V a, V b) noexcept { return _mm_or_si128(a, b); }
+
+    //* broadcast the bit pattern of a W byte value
+    template <std::size_t W>
+    static V set1(std::uint64_t v) noexcept {
+        if constexpr (W == 1) return _mm_set1_epi8(static_cast<char>(v));
+        else if constexpr (W == 2) return _mm_set1_epi16(static_cast<short>(v));
+        else if constexpr (W == 4) return _mm_set1_epi32(static_cast<int>(v));
+        else return _mm_set1_epi64x(static_cast<long long>(v));
+    }
+
+    //* element wise a == b (all bits of an element set if equal)
+    template <std::size_t W>
+    static V cmpeq(V a, V b) noexcept {
+        if constexpr (W == 1) return _mm_cmpeq_epi8(a, b);
+        else if constexpr (W == 2) return _mm_cmpeq_epi16(a, b);
+        else if constexpr (W == 4) return _mm_cmpeq_epi32(a, b);
+        else {
+            const V e = _mm_cmpeq_epi32(a, b);
+            return _mm_and_si128(e, _mm_shuffle_epi32(e, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+    }
+
+    //* signed 64 bit comparison is not available
+    static constexpr bool CMPGT64 = false;
+
+    //* element wise signed a > b (W = 1, 2 or 4)
+    template <std::size_t W>
+    static V cmpgt(V a, V b) noexcept {
+        static_assert(W <= 4, "64 bit comparison requires SSE4.2");
+        if constexpr (W == 1) return _mm_cmpgt_epi8(a, b);
+        else if constexpr (W == 2) return _mm_cmpgt_epi16(a, b);
+        else return _mm_cmpgt_epi32(a, b);
+    }
+
+    //* element wise floating point a == b
+    template <typename T>
+    static V cmpeq_f(V a, V b) noexcept {
+        if constexpr (std::is_same<T, float>::value)
+            return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+        else return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+    }
+
+    //* element wise floating point a <= b
+    template <typename T>
+    static V cmple_f(V a, V b) noexcept {
+        if constexpr (std::is_same<T, float>::value)
+            return _mm_castps_si128(_mm_cmple_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+        else return _mm_castpd_si128(_mm_cmple_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+    }
+
+    //* one bit per W byte element of a comparison result
+    template <std::size_t W>
+    static std::uint32_t mask(V v) noexcept {
+        if constexpr (W == 1) return static_cast<std::uint32_t>(_mm_movemask_epi8(v));
+        else if constexpr (W == 2)
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(v, _mm_setzero_si128())));
+        else if constexpr (W == 4) return static_cast<std::uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(v)));
+        else return static_cast<std::uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(v)));
+    }
+
+    //* W = 1: unsigned, W = 2: signed, W = 4: signed comparison
+    template <std::size_t W, bool MAX>
+    static V minmax(V a, V b) noexcept {
+        if constexpr (W == 1) return MAX ? _mm_max_epu8(a, b) : _mm_min_epu8(a, b);
+        else if constexpr (W == 2) return MAX ? _mm_max_epi16(a, b) : _mm_min_epi16(a, b);
+        else {
+            const V gt = MAX ? _mm_cmpgt_epi32(a, b) : _mm_cmpgt_epi32(b, a);
+            return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+        }
+    }
+
+    template <typename T>
+    static auto as_float(V v) noexcept {
+        if constexpr (std::is_same<T, float>::value) return _mm_castsi128_ps(v);
+        else return _mm_castsi128_pd(v);
+    }
+    template <typename T>
+    static auto fzero() noexcept {
+        if constexpr (std::is_same<T, float>::value) return _mm_setzero_ps();
+        else return _mm_setzero_pd();
+    }
+    static __m128  add(__m128 a, __m128 b) noexcept { return _mm_add_ps(a, b); }
+    static __m128d add(__m128d a, __m128d b) noexcept { return _mm_add_pd(a, b); }
+    static __m128  mul(__m128 a, __m128 b) noexcept { return _mm_mul_ps(a, b); }
+    static __m128d mul(__m128d a, __m128d b) noexcept { return _mm_mul_pd(a, b); }
+    static __m128  min(__m128 a, __m128 b) noexcept { return _mm_min_ps(a, b); }
+    static __m128d min(__m128d a, __m128d b) noexcept { return _mm_min_pd(a, b); }
+    static __m128  max(__m128 a, __m128 b) noexcept { return _mm_max_ps(a, b); }
+    static __m128d max(__m128d a, __m128d b) noexcept { return _mm_max_pd(a, b); }
+    static void    store(float *p, __m128 v) noexcept { _mm_storeu_ps(p, v); }
+    static void    store(double *p, __m128d v) noexcept { _mm_storeu_pd(p, v); }
+};
+#endif
+
+#if defined(CXXENDIAN_HAVE_AVX2)
+/**
+ * @brief 256 bit vector operations of the reduction and search kernels
+ */
+struct Avx2_Ops {
+    using V = __m256i;
+
+    static constexpr std::size_t BYTES = 32;
+
+    static V load(const std::uint8_t *p) noexcept {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    }
+    static void store(void *p, V v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+    template <std::size_t W>
+    static V swap(V v) noexcept {
+        return swap_vec<W>(v);
+    }
+
+    static V zero() noexcept { return _mm256_setzero_si256(); }
+    static V set1_8(std::int8_t v) noexcept { return _mm256_set1_epi8(static_cast<char>(v)); }
+    static V set1_16(std::int16_t v) noexcept { return _mm256_set1_epi16(v); }
+    static V set1_32(std::int32_t v) noexcept { return _mm256_set1_epi32(v); }
+    static V bxor(V a, V b) noexcept { return _mm256_xor_si256(a, b); }
+    static V add32(V a, V b) noexcept { return _mm256_add_epi32(a, b); }
+    static V add64(V a, V b) noexcept { return _mm256_add_epi64(a, b); }
+    static V sad_u8(V a) noexcept { return _mm256_sad_epu8(a, _mm256_setzero_si256()); }
+    static V madd16(V a, V b) noexcept { return _mm256_madd_epi16(a, b); }
+    static V sign32(V v) noexcept { return _mm256_srai_epi32(v, 31); }
+    static V unpacklo32(V a, V b) noexcept { return _mm256_unpacklo_epi32(a, b); }
+    static V unpackhi32(V a, V b) noexcept { return _mm256_unpackhi_epi32(a, b); }
+    static V unpacklo16(V a, V b) noexcept { return _mm256_unpacklo_epi16(a, b); }
+    static V unpackhi16(V a, V b) noexcept { return _mm256_unpackhi_epi16(a, b); }
+    static V sign16(V v) noexcept { return _mm256_srai_epi16(v, 15); }
+    static V band(V a, V b) noexcept { return _mm256_and_si256(a, b); }
+    static V sub64(V a, V b) noexcept { return _mm256_sub_epi64(a, b); }
+    static V mul_u32(V a, V b) noexcept { return _mm256_mul_epu32(a, b); }
+    static V srli64(V v) noexcept { return _mm256_srli_epi64(v, 32); }
+    static V slli64(V v) noexcept { return _mm256_slli_epi64(v, 32); }
+    static V hi32_mask() noexcept { return _mm256_set1_epi64x(static_cast<long long>(0xFFFFFFFF00000000ULL)); }
+
+    static V ones() noexcept { return _mm256_cmpeq_epi32(_mm256_setzero_si256(), _mm256_setzero_si256()); }
+    static V bor(V a, V b) noexcept { return _mm256_or_si256(a, b); }
+
+    //* broadcast the bit pattern of a W byte value
+    template <std::size_t W>
+    static V set1(std::uint64_t v) noexcept {
+        if constexpr (W == 1) return _mm256_set1_epi8(static_cast<char>(v));
+        else if constexpr (W == 2) return _mm256_set1_epi16(static_cast<short>(v));
+        else if constexpr (W == 4) return _mm256_set1_epi32(static_cast<int>(v));
+        else return _mm256_set1_epi64x(static_cast<long long>(v));
+    }
+
+    //* element wise a == b (all bits of an element set if equal)
+    template <std::size_t W>
+    static V cmpeq(V a, V b) noexcept {
+        if constexpr (W == 1) return _mm256_cmpeq_epi8(a, b);
+        else if constexpr (W == 2) return _mm256_cmpeq_epi16(a, b);
+        else if constexpr (W == 4) return _mm256_cmpeq_epi32(a, b);
+        else return _mm256_cmpeq_epi64(a, b);
+    }
+
+    //* signed 64 bit comparison is available
+    static constexpr bool CMPGT64 = true;
+
+    //* element wise signed a > b
+    template <std::size_t W>
+    static V cmpgt(V a, V b) noexcept {
+        if constexpr (W == 1) return _mm256_cmpgt_epi8(a, b);
+        else if constexpr (W == 2) return _mm256_cmpgt_epi16(a, b);
+        else if constexpr (W == 4) return _mm256_cmpgt_epi32(a, b);
+        else return _mm256_cmpgt_epi64(a, b);
+    }
+
+    //* element wise floating point a == b
+    template <typename T>
+    static V cmpeq_f(V a, V b) noexcept {
+        if constexpr (std::is_same<T, float>::value)
+            return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+        else return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+    }
+
+    //* element wise floating point a <= b
+    template <typename T>
+    static V cmple_f(V a, V b) noexcept {
+        if constexpr (std::is_same<T, float>::value)
+            return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_LE_OQ));
+        else return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_LE_OQ));
+    }
+
+    //* one bit per W byte element of a comparison result
+    template <std::size_t W>
+    static std::uint32_t mask(V v) noexcept {
+        if constexpr (W == 1) return static_cast<std::uint32_t>(_mm256_movemask_epi8(v));
+        else if constexpr (W == 2) {
+            // packs works per 128 bit lane: elements 0..7 end up in bytes 0..7, elements 8..15 in bytes 16..23
+            const V    packed = _mm256_packs_epi16(v, _mm256_setzero_si256());
+            const auto m      = static_cast<std::uint32_t>(_mm256_movemask_epi8(packed));
+            return (m & 0xFFu) | ((m >> 8) & 0xFF00u);
+        } else if constexpr (W == 4) return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(v)));
+        else return static_cast<std::uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(v)));
+    }
+
+    //* W = 1: unsigned, W = 2: signed, W = 4: signed comparison
+    template <std::size_t W, bool MAX>
+    static V minmax(V a, V b) noexcept {
+        if constexpr (W == 1) return MAX ? _mm256_max_epu8(a, b) : _mm256_min_epu8(a, b);
+        else if constexpr (W == 2) return MAX ? _mm256_max_epi16(a, b) : _mm256_min_epi16(a, b);
+        else return MAX ? _mm256_max_epi32(a, b) : _mm256_min_epi32(a, b);
+    }
+
+    template <typename T>
+    static auto as_float(V v) noexcept {
+        if constexpr (std::is_same<T, float>::value) return _mm256_castsi256_ps(v);
+        else return _mm256_castsi256_pd(v);
+    }
+    template <typename T>
+    static auto fzero() noexcept {
+        if constexpr (std::is_same<T, float>::value) return _mm256_setzero_ps();
+        else return _mm256_setzero_pd();
+    }
+    static __m256  add(__m256 a, __m256 b) noexcept { return _mm256_add_ps(a, b); }
+    static __m256d add(__m256d a, __m256d b) noexcept { return _mm256_add_pd(a, b); }
+    static __m256  mul(__m256 a, __m256 b) noexcept { return _mm256_mul_ps(a, b); }
+    static __m256d mul(__m256d a, __m256d b) noexcept { return _mm256_mul_pd(a, b); }
+    static __m256  min(__m256 a, __m256 b) noexcept { return _mm256_min_ps(a, b); }
+    static __m256d min(__m256d a, __m256d b) noexcept { return _mm256_min_pd(a, b); }
+    static __m256  max(__m256 a, __m256 b) noexcept { return _mm256_max_ps(a, b); }
+    static __m256d max(__m256d a, __m256d b) noexcept { return _mm256_max_pd(a, b); }
+    static void    store(float *p, __m256 v) noexcept { _mm256_storeu_ps(p, v); }
+    static void    store(double *p, __m256d v) noexcept { _mm256_storeu_pd(p, v); }
+};
+#endif
+
+#if defined(CXXENDIAN_HAVE_AVX2)
+using Vec_Ops = Avx2_Ops;
+#elif defined(CXXENDIAN_HAVE_SSE2)
+using Vec_Ops = Sse2_Ops;
+#endif
+
+#if defined(CXXENDIAN_HAVE_SSE2)
+/**
+ * @brief load a vector of W byte elements in byte order order and convert it to host endian (in register)
+ */
+template <typename Ops, Order order, std::size_t W>
+inline typename Ops::V load_vec(const std::uint8_t *p) noexcept {
+    if constexpr (order == HostOrder || W == 1) return Ops::load(p);
+    else return Ops::template swap<W>(Ops::load(p));
+}
+#endif
+
+}  // namespace detail
+
+}  // namespace endian
@@ -0,0 +1,16 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+/*
+ * Explicit instantiation definitions for the library target cxxendian_compiled (see cxxendian/extern_templates.hpp).
+ */
+
+#include "cxxendian.hpp"
+
+namespace cxxendian {
+
+CXXENDIAN_INSTANTIATE_ALL()
+
+}  // namespace cxxendian
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/arena.hpp"
+#include "cxxendian/serialize.hpp"
+#include "check.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace cxxendian;
+
+static bool aligned(const void *p) {
+    return reinterpret_cast<std::uintptr_t>(p) % CACHE_LINE == 0;
+}
+
+int main() {
+    // arena: alignment, rewind and block reuse
+    {
+        Arena a(1024);
+        auto *p = a.allocate(10);
+        auto *q = a.allocate(10);
+        CHECK(aligned(p) && aligned(q) && q == static_cast<std::uint8_t *>(p) + CACHE_LINE);
+        CHECK(a.allocate(4, 4) == static_cast<std::uint8_t *>(q) + 12);
+
+        const auto m     = a.mark();
+        auto      *big   = a.allocate<std::uint32_t>(1000);  // own block
+        auto      *small = a.allocate(100);
+        CHECK(aligned(big) && aligned(small));
+        const auto cap = a.capacity();
+        CHECK(cap >= 1024 + 4000);
+
+        a.rewind(m);
+        CHECK(a.allocate<std::uint32_t>(1000) == big);
+        a.reset();
+        CHECK(a.allocate(10) == p);
+        for (int i = 0; i < 100; ++i)
+            a.allocate(100);
+        a.reset();
+        for (int i = 0; i < 100; ++i)
+            a.allocate(100);
+        CHECK(a.capacity() > cap);
+        const auto cap2 = a.capacity();
+        a.reset();
+        for (int i = 0; i < 100; ++i)
+            a.allocate(100);
+        CHECK(a.capacity() == cap2);  // steady state: no new blocks
+    }
+
+    // scope and scratch conversion
+    {
+        const std::uint8_t wire[] = {0, 0, 0, 1, 0, 0, 1, 0, 0xFF, 0xFF, 0xFF, 0xFE};
+        const auto         before = thread_arena().mark();
+        {
+            Arena_Scope scope;
+            const auto *v = to_host_scratch<endian::Order::Big, std::int32_t>(wire, 3);
+            CHECK(aligned(v) && v[0] == 1 && v[1] == 256 && v[2] == -2);
+
+            const auto *w = from_host_scratch<endian::Order::Big>(v, 3);
+            CHECK(std::memcmp(w, wire, sizeof(wire)) == 0);
+        }
+        const auto after = thread_arena().mark();
+        CHECK(before.block == after.block && before.offset == after.offset);
+    }
+
+    // pool: size classes and reuse
+    {
+        Pool  pool;
+        void *a = pool.allocate(1);
+        void *b = pool.allocate(64);
+        void *c = pool.allocate(65);
+        CHECK(aligned(a) && aligned(b) && aligned(c));
+        pool.deallocate(a, 1);
+        CHECK(pool.allocate(64) == a);  // same class
+        pool.deallocate(c, 65);
+        CHECK(pool.allocate(128) == c);
+        CHECK(pool.allocate(100) != c);
+
+        void *huge = pool.allocate(Pool::MAX_SIZE + 1);
+        CHECK(aligned(huge));
+        pool.deallocate(huge, Pool::MAX_SIZE + 1);
+        pool.deallocate(b, 64);
+
+        auto *d = pool.allocate<double>(3);
+        pool.deallocate(d, 3);
+        CHECK(pool.allocate<double>(4) == d);
+    }
+
+    // allocators with containers and Writer
+    {
+        Arena arena;
+
+        std::vector<std::uint32_t, Arena_Allocator<std::uint32_t>> v {Arena_Allocator<std::uint32_t>(arena)};
+        for (std::uint32_t i = 0; i < 1000; ++i)
+            v.push_back(i);
+        CHECK(v[999] == 999 && aligned(v.data()));
+
+        Writer<endian::Order::Big, Arena_Allocator<std::uint8_t>> w {Arena_Allocator<std::uint8_t>(arena)};
+        w.put_n(v.data(), v.size());
+        CHECK(w.size() == 4000 && w.data()[3] == 0 && w.data()[7] == 1);
+
+        Pool pool;
+
+        std::vector<std::uint16_t, Pool_Allocator<std::uint16_t>> p {Pool_Allocator<std::uint16_t>(pool)};
+        p.assign(500, 7);
+        CHECK(p.size() == 500 && p[499] == 7);
+    }
+
+    return test_result();
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+/*
+ * Representative uses of the library for the assembly regression test (see check_asm.cmake).
+ * This file is only compiled, never executed. The prefix of each function name selects the expected code:
+ *  - probe_swap_*: exactly one byte swap instruction (bswap/movbe/rol/rev), no loop, no call
+ *  - probe_noop_*: no byte swap instruction at all, no call
+ * The expectations assume a little endian host.
+ */
+
+#include "cxxendian.hpp"
+
+#include <cstdint>
+
+using namespace cxxendian;
+
+extern "C" {
+
+std::uint32_t probe_swap_be_int_get(const BE_Int<std::uint32_t> &v) noexcept {
+    return v.get();
+}
+
+std::uint16_t probe_swap_be_int_get16(const BE_Int<std::uint16_t> &v) noexcept {
+    return v.get();
+}
+
+std::uint64_t probe_swap_be_int_get64(const BE_Int<std::uint64_t> &v) noexcept {
+    return v.get();
+}
+
+std::uint64_t probe_swap_host_to_big(std::uint64_t v) noexcept {
+    return endian::host_to_big(v);
+}
+
+std::uint32_t probe_swap_big_to_host_load(const std::uint32_t *p) noexcept {
+    return endian::big_to_host(*p);
+}
+
+void probe_swap_host_to_big_store(std::uint32_t *p, std::uint32_t v) noexcept {
+    *p = endian::host_to_big(v);
+}
+
+std::uint64_t probe_swap_be_float_ctor(double v) noexcept {
+    return BE_Float<double>(v).get_raw();
+}
+
+double probe_swap_be_float_get(const BE_Float<double> &v) noexcept {
+    return v.get();
+}
+
+std::uint64_t probe_noop_host_to_little(std::uint64_t v) noexcept {
+    return endian::host_to_little(v);
+}
+
+std::uint32_t probe_noop_little_to_host(std::uint32_t v) noexcept {
+    return endian::little_to_host(v);
+}
+
+std::uint32_t probe_noop_le_int_get(const LE_Int<std::uint32_t> &v) noexcept {
+    return v.get();
+}
+
+std::uint64_t probe_noop_le_float_ctor(double v) noexcept {
+    return LE_Float<double>(v).get_raw();
+}
+
+double probe_noop_le_float_get(const LE_Float<double> &v) noexcept {
+    return v.get();
+}
+
+}  // extern "C"
@@ -0,0 +1,309 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/bulk.hpp"
+#include "cxxendian/columnar.hpp"
+#include "cxxendian/convert.hpp"
+#include "cxxendian/stream.hpp"
+#include "cxxendian/strided.hpp"
+#include "check.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+template <typename T>
+static void test_swap_n() {
+    // odd length and unaligned source to hit vector body and scalar tail
+    constexpr std::size_t     N = 131;
+    std::vector<std::uint8_t> raw(N * sizeof(T) + 1);
+    for (std::size_t i = 0; i < raw.size(); ++i)
+        raw[i] = static_cast<std::uint8_t>(i * 7 + 3);
+
+    std::vector<T> out(N);
+    endian::big_to_host_n(raw.data() + 1, out.data(), N);
+
+    for (std::size_t i = 0; i < N; ++i) {
+        T v;
+        std::memcpy(&v, raw.data() + 1 + i * sizeof(T), sizeof(T));
+        v = endian::big_to_host(v);
+        CHECK(std::memcmp(&out[i], &v, sizeof(T)) == 0);
+    }
+
+    // in place round trip
+    std::vector<T> copy(out);
+    endian::swap_n(out.data(), out.data(), N);
+    endian::swap_n(out.data(), out.data(), N);
+    CHECK(std::memcmp(out.data(), copy.data(), N * sizeof(T)) == 0);
+}
+
+static void test_convert() {
+    const std::int16_t samples[] = {0, 1, -1, 32767, -32768, 1000, -1000};
+    constexpr std::size_t N = sizeof(samples) / sizeof(samples[0]);
+
+    std::uint8_t wire[N * 2];
+    endian::host_to_big_n(samples, wire, N);
+
+    float volts[N];
+    endian::big_to_host_convert_n<std::int16_t>(wire, volts, N, 0.5f, 1.f);
+    for (std::size_t i = 0; i < N; ++i)
+        CHECK(equal_exact(static_cast<float>(samples[i]) * 0.5f + 1.f, volts[i]));
+
+    // float -> big endian int16 with saturation
+    const float  in[] = {0.f, 1.4f, -1.6f, 1e9f, -1e9f, std::numeric_limits<float>::quiet_NaN()};
+    std::int16_t expect[] = {0, 1, -2, 32767, -32768, 0};
+    std::uint8_t out[sizeof(expect)];
+    endian::host_to_big_convert_n<std::int16_t>(in, out, 6);
+    std::int16_t back[6];
+    endian::big_to_host_n(out, back, 6);
+    CHECK(std::memcmp(back, expect, sizeof(expect)) == 0);
+
+    // little endian uint32 -> double
+    std::vector<std::uint32_t> u(1000);
+    for (std::size_t i = 0; i < u.size(); ++i)
+        u[i] = static_cast<std::uint32_t>(i * 4000037u);
+    std::vector<std::uint8_t> le(u.size() * 4);
+    endian::host_to_little_n(u.data(), le.data(), u.size());
+    std::vector<double> d(u.size());
+    endian::little_to_host_convert_n<std::uint32_t>(le.data(), d.data(), d.size());
+    for (std::size_t i = 0; i < u.size(); ++i)
+        CHECK(equal_exact(d[i], static_cast<double>(u[i])));
+
+    // int -> int narrowing saturates
+    const std::int32_t wide[] = {-70000, 70000, 5, -5};
+    std::uint8_t       le16[8];
+    endian::host_to_little_convert_n<std::int16_t>(wide, le16, 4);
+    std::int16_t narrow[4];
+    endian::little_to_host_n(le16, narrow, 4);
+    CHECK(narrow[0] == -32768 && narrow[1] == 32767 && narrow[2] == 5 && narrow[3] == -5);
+}
+
+template <typename T>
+static void test_alignment() {
+    // large enough for the aligned kernels, all combinations of input and output misalignment
+    constexpr std::size_t     N = 1000;
+    std::vector<std::uint8_t> in(N * sizeof(T) + 128);
+    std::vector<std::uint8_t> out(N * sizeof(T) + 128);
+    std::vector<std::uint8_t> ref(N * sizeof(T));
+    for (std::size_t i = 0; i < in.size(); ++i)
+        in[i] = static_cast<std::uint8_t>(i * 5 + 11);
+
+    auto *in_base  = in.data() + (64 - reinterpret_cast<std::uintptr_t>(in.data()) % 64);
+    auto *out_base = out.data() + (64 - reinterpret_cast<std::uintptr_t>(out.data()) % 64);
+
+    for (std::size_t si = 0; si < 64; si += 3) {
+        for (std::size_t di = 0; di < 64; di += 5) {
+            endian::detail::swap_scalar<sizeof(T)>(in_base + si, ref.data(), N);
+
+            auto *dst = reinterpret_cast<T *>(out_base + di);
+            endian::to_host_n<endian::Order::Big>(in_base + si, dst, N, endian::non_temporal);
+            CHECK(std::memcmp(out_base + di, ref.data(), ref.size()) == 0 || endian::HostOrder == endian::Order::Big);
+
+            std::memset(out.data(), 0, out.size());
+            endian::detail::swap_bytes_aligned<sizeof(T), false>(in_base + si, out_base + di, N);
+            CHECK(std::memcmp(out_base + di, ref.data(), ref.size()) == 0);
+        }
+    }
+
+    endian::detail::swap_scalar<sizeof(T)>(in_base, ref.data(), N);
+    endian::swap_n(reinterpret_cast<const T *>(in_base), reinterpret_cast<T *>(out_base), N, endian::assume_aligned);
+    CHECK(std::memcmp(out_base, ref.data(), ref.size()) == 0);
+}
+
+static void test_stream() {
+    constexpr std::size_t              N = 100003;
+    endian::Huge_Buffer<std::uint32_t> in(N);
+    endian::Huge_Buffer<std::uint32_t> out(N);
+    std::vector<std::uint32_t>         ref(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        in[i]  = static_cast<std::uint32_t>(i * 2654435761u);
+        ref[i] = endian::big_to_host(in[i]);
+    }
+
+    endian::Stream_Params params;
+    for (std::size_t distance : {std::size_t(0), std::size_t(64), std::size_t(4096)}) {
+        for (bool nt : {false, true}) {
+            params.prefetch_distance = distance;
+            params.non_temporal      = nt;
+            params.block_bytes       = 1000;
+            std::memset(out.data(), 0, N * 4);
+            endian::to_host_stream_n<endian::Order::Big>(in.data(), out.data(), N, params);
+            CHECK(std::memcmp(out.data(), ref.data(), N * 4) == 0);
+        }
+    }
+
+    // output not aligned to a cache line (element aligned prologue) and not aligned to the element size
+    std::vector<std::uint8_t> unaligned(N * 4 + 64);
+    for (std::size_t offset : {std::size_t(4), std::size_t(60), std::size_t(3)}) {
+        for (bool nt : {false, true}) {
+            params.prefetch_distance = 256;
+            params.non_temporal      = nt;
+            params.block_bytes       = 4096;
+            std::fill(unaligned.begin(), unaligned.end(), std::uint8_t(0));
+            endian::from_host_stream_n<endian::Order::Big>(ref.data(), unaligned.data() + offset, N, params);
+            CHECK(std::memcmp(unaligned.data() + offset, in.data(), N * 4) == 0);
+        }
+    }
+
+    const auto tuned = endian::calibrate_stream(std::size_t(1) << 20);
+    std::memset(out.data(), 0, N * 4);
+    endian::from_host_stream_n<endian::Order::Big>(ref.data(), out.data(), N, tuned);
+    CHECK(std::memcmp(out.data(), in.data(), N * 4) == 0);
+}
+
+template <typename T>
+static void test_strided() {
+    // records of 29 bytes (odd stride), field at offset 3
+    constexpr std::size_t     N = 77, STRIDE = 29, OFFSET = 3;
+    std::vector<std::uint8_t> records(N * STRIDE);
+    for (std::size_t i = 0; i < records.size(); ++i)
+        records[i] = static_cast<std::uint8_t>(i * 13 + 1);
+
+    std::vector<T> column(N);
+    endian::to_host_strided_n<endian::Order::Big>(records.data() + OFFSET, STRIDE, column.data(), N);
+
+    std::vector<std::int32_t> offsets(N);
+    for (std::size_t i = 0; i < N; ++i)
+        offsets[i] = static_cast<std::int32_t>(((i * 31) % N) * STRIDE + OFFSET);
+    std::vector<T> gathered(N);
+    endian::to_host_gather_n<endian::Order::Big>(records.data(), offsets.data(), gathered.data(), N);
+
+    for (std::size_t i = 0; i < N; ++i) {
+        T v;
+        std::memcpy(&v, records.data() + i * STRIDE + OFFSET, sizeof(T));
+        v = endian::big_to_host(v);
+        CHECK(std::memcmp(&column[i], &v, sizeof(T)) == 0);
+
+        std::memcpy(&v, records.data() + static_cast<std::size_t>(offsets[i]), sizeof(T));
+        v = endian::big_to_host(v);
+        CHECK(std::memcmp(&gathered[i], &v, sizeof(T)) == 0);
+    }
+
+    // writing the columns back restores the records
+    std::vector<std::uint8_t> copy(records);
+    std::memset(records.data(), 0, records.size());
+    endian::from_host_strided_n<endian::Order::Big>(column.data(), records.data() + OFFSET, STRIDE, N);
+    for (std::size_t i = 0; i < N; ++i)
+        CHECK(std::memcmp(records.data() + i * STRIDE + OFFSET, copy.data() + i * STRIDE + OFFSET, sizeof(T)) == 0);
+
+    std::memset(records.data(), 0, records.size());
+    endian::from_host_scatter_n<endian::Order::Big>(gathered.data(), records.data(), offsets.data(), N);
+    for (std::size_t i = 0; i < N; ++i)
+        CHECK(std::memcmp(records.data() + i * STRIDE + OFFSET, copy.data() + i * STRIDE + OFFSET, sizeof(T)) == 0);
+}
+
+static void test_columnar() {
+    using namespace cxxendian;
+    using Codec = Record_Codec<Field<BE_Int<std::uint32_t>, 0>,
+                               Field<BE_Int<std::int16_t>, 4>,
+                               Field<LE_Float<double>, 7>,
+                               Field<Host_Int<std::uint8_t>, 6>>;
+    static_assert(Codec::size == 15, "unexpected record size");
+
+    constexpr std::size_t N = 5000, STRIDE = 16;  // one byte padding per record
+
+    std::vector<std::uint32_t> a(N);
+    std::vector<std::int16_t>  b(N);
+    std::vector<double>        c(N);
+    std::vector<std::uint8_t>  d(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        a[i] = static_cast<std::uint32_t>(i * 2654435761u);
+        b[i] = static_cast<std::int16_t>(i * 7);
+        c[i] = static_cast<double>(i) * 0.25;
+        d[i] = static_cast<std::uint8_t>(i);
+    }
+
+    std::vector<std::uint8_t> records(N * STRIDE, 0xEE);
+    Codec::encode_strided(records.data(), STRIDE, N, a.data(), b.data(), c.data(), d.data());
+
+    // check one record against the per object types
+    const std::uint8_t *r = records.data() + 42 * STRIDE;
+    std::uint32_t       raw_a;
+    std::memcpy(&raw_a, r, 4);
+    CHECK(endian::big_to_host(raw_a) == a[42]);
+    CHECK(r[15] == 0xEE);
+
+    std::vector<std::uint32_t> a2(N);
+    std::vector<std::int16_t>  b2(N);
+    std::vector<double>        c2(N);
+    std::vector<std::uint8_t>  d2(N);
+    Codec::decode_strided(records.data(), STRIDE, N, a2.data(), b2.data(), c2.data(), d2.data());
+    CHECK(a == a2);
+    CHECK(b == b2);
+    CHECK(c == c2);
+    CHECK(d == d2);
+
+    // densely packed records
+    std::vector<std::uint8_t> packed(N * Codec::size);
+    Codec::encode(packed.data(), N, a.data(), b.data(), c.data(), d.data());
+    std::fill(a2.begin(), a2.end(), 0u);
+    std::fill(c2.begin(), c2.end(), 0.);
+    Codec::decode(packed.data(), N, a2.data(), b2.data(), c2.data(), d2.data());
+    CHECK(a == a2);
+    CHECK(c == c2);
+}
+
+static void test_type_conversion() {
+    cxxendian::BE_Int<std::int32_t> i(-42);
+    cxxendian::LE_Float<double>     f(i);
+    CHECK(equal_exact(f.get(), -42.0));
+
+    cxxendian::BE_Int<std::int16_t> j(f);
+    CHECK(j.get() == -42);
+}
+
+// signaling NaNs with payload, denormals and negative zero survive the bulk conversions bit exactly
+template <typename T>
+static void test_float_bits_n() {
+    using U                = typename endian::detail::Uint_Of<sizeof(T)>::type;
+    constexpr U QUIET      = sizeof(T) == 4 ? U(0x00400000u) : static_cast<U>(0x0008000000000000ull);
+    const U     patterns[] = {static_cast<U>(endian::detail::to_bits(std::numeric_limits<T>::infinity()) | 1u),
+                              static_cast<U>(endian::detail::to_bits(-std::numeric_limits<T>::infinity()) | 0x35u),
+                              static_cast<U>(endian::detail::to_bits(std::numeric_limits<T>::infinity()) | QUIET | 7u),
+                              endian::detail::to_bits(std::numeric_limits<T>::denorm_min()),
+                              endian::detail::to_bits(-T(0))};
+
+    constexpr std::size_t N = 67;
+    std::vector<T>        host(N);
+    for (std::size_t i = 0; i < N; ++i)
+        host[i] = endian::detail::from_bits<T>(patterns[i % 5]);
+    const auto same = [](const std::vector<T> &a, const std::vector<T> &b) {
+        return std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+    };
+
+    std::vector<T> wire(N), back(N);
+    endian::host_to_big_n(host.data(), wire.data(), N);
+    endian::big_to_host_n(wire.data(), back.data(), N);
+    CHECK(same(host, back));
+    endian::swap_n(host.data(), wire.data(), N);
+    endian::swap_n(wire.data(), back.data(), N);
+    CHECK(same(host, back));
+}
+
+int main() {
+    test_swap_n<std::uint16_t>();
+    test_swap_n<std::uint32_t>();
+    test_swap_n<std::uint64_t>();
+    test_swap_n<float>();
+    test_swap_n<double>();
+    test_convert();
+    test_alignment<std::uint16_t>();
+    test_alignment<std::uint32_t>();
+    test_alignment<double>();
+    test_stream();
+    test_strided<std::uint16_t>();
+    test_strided<std::uint32_t>();
+    test_strided<std::uint64_t>();
+    test_strided<float>();
+    test_columnar();
+    test_type_conversion();
+    test_float_bits_n<float>();
+    test_float_bits_n<double>();
+
+    return test_result();
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+/*
+ * Minimal check macro of the test executables: a failed check is reported with file and line and the test continues.
+ * main returns test_result().
+ */
+
+#pragma once
+
+#include <cstdlib>
+#include <iostream>
+
+//* number of failed checks
+inline int failed = 0;
+
+#define CHECK(expr)                                                                                                    \
+    do {                                                                                                               \
+        if (!(expr)) {                                                                                                 \
+            std::cerr << __FILE__ << ':' << __LINE__ << ": check failed: " #expr << std::endl;                         \
+            ++failed;                                                                                                  \
+        }                                                                                                              \
+    } while (0)
+
+//* exit status of the test executable (prints the number of failed checks)
+inline int test_result() {
+    if (failed) std::cerr << failed << " check(s) failed" << std::endl;
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+//* exact comparison, also of floating point values (the tests expect exact results where they use it)
+template <typename T>
+bool equal_exact(const T &a, const T &b) {
+#if defined(__GNUC__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wfloat-equal"
+#endif
+    return a == b;
+#if defined(__GNUC__)
+#    pragma GCC diagnostic pop
+#endif
+}
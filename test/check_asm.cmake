@@ -0,0 +1,102 @@
+#
+# Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+# This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+#
+
+# Assembly regression test: disassembles the probe functions of asm_probe.cpp and checks that every conversion
+# lowers to a single byte swap instruction (probe_swap_*) or to nothing (probe_noop_*).
+#
+# usage: cmake -DOBJDUMP=<objdump> -DOBJECT=<asm_probe object file> -DARCH=<x86_64|aarch64> -P check_asm.cmake
+
+if(NOT OBJDUMP OR NOT OBJECT)
+    message(FATAL_ERROR "OBJDUMP and OBJECT must be set")
+endif()
+
+if(ARCH STREQUAL "aarch64")
+    set(SWAP_REGEX "^(rev|rev16|rev32)$")
+    set(BRANCH_REGEX "^(b|bl|blr|br|b\\..*|cbz|cbnz|tbz|tbnz)$")
+else()
+    set(SWAP_REGEX "^(bswap|movbe|rol|ror|xchg)$")
+    set(BRANCH_REGEX "^(call|jmp|j[a-z]+)$")
+endif()
+
+# maximum number of instructions (without ret, nop and endbr) per probe
+set(MAX_INSTRUCTIONS 4)
+
+execute_process(
+        COMMAND ${OBJDUMP} -d --no-show-raw-insn ${OBJECT}
+        OUTPUT_VARIABLE DISASSEMBLY
+        RESULT_VARIABLE RESULT)
+if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "${OBJDUMP} failed")
+endif()
+
+# one list element per line (remove characters with special meaning in lists)
+string(REPLACE ";" "," DISASSEMBLY "${DISASSEMBLY}")
+string(REPLACE "[" "(" DISASSEMBLY "${DISASSEMBLY}")
+string(REPLACE "]" ")" DISASSEMBLY "${DISASSEMBLY}")
+string(REPLACE "\n" ";" LINES "${DISASSEMBLY}")
+
+set(FAILED 0)
+set(PROBES 0)
+set(FUNCTION "")
+
+# check the function collected so far
+macro(check_function)
+    if(FUNCTION MATCHES "^probe_(swap|noop)_")
+        math(EXPR PROBES "${PROBES} + 1")
+        set(ERROR "")
+        if(FUNCTION MATCHES "^probe_swap_" AND NOT SWAPS EQUAL 1)
+            set(ERROR "expected exactly one byte swap instruction, found ${SWAPS}")
+        elseif(FUNCTION MATCHES "^probe_noop_" AND NOT SWAPS EQUAL 0)
+            set(ERROR "expected no byte swap instruction, found ${SWAPS}")
+        elseif(BRANCHES GREATER 0)
+            set(ERROR "unexpected branch or call (loop or virtual call)")
+        elseif(INSTRUCTIONS GREATER MAX_INSTRUCTIONS)
+            set(ERROR "${INSTRUCTIONS} instructions (limit: ${MAX_INSTRUCTIONS})")
+        endif()
+
+        if(ERROR)
+            math(EXPR FAILED "${FAILED} + 1")
+            message(SEND_ERROR "${FUNCTION}: ${ERROR}\n${BODY}")
+        else()
+            message(STATUS "${FUNCTION}: ok (${INSTRUCTIONS} instructions)")
+        endif()
+    endif()
+endmacro()
+
+foreach(LINE IN LISTS LINES)
+    if(LINE MATCHES "^[0-9a-f]+ <([A-Za-z0-9_]+)>:$")
+        set(NEXT_FUNCTION "${CMAKE_MATCH_1}")
+        check_function()
+        set(FUNCTION "${NEXT_FUNCTION}")
+        set(SWAPS 0)
+        set(BRANCHES 0)
+        set(INSTRUCTIONS 0)
+        set(BODY "")
+    elseif(FUNCTION AND LINE MATCHES "^ *[0-9a-f]+:\t([a-z0-9.]+)")
+        set(MNEMONIC "${CMAKE_MATCH_1}")
+        string(APPEND BODY "${LINE}\n")
+        if(MNEMONIC MATCHES "^(ret|retq|nop|nopl|nopw|endbr64|data16|cs|xchg)$" AND NOT LINE MATCHES "%a[hl]")
+            # padding and function exit
+        else()
+            math(EXPR INSTRUCTIONS "${INSTRUCTIONS} + 1")
+            if(MNEMONIC MATCHES "${SWAP_REGEX}")
+                math(EXPR SWAPS "${SWAPS} + 1")
+            elseif(MNEMONIC MATCHES "${BRANCH_REGEX}")
+                math(EXPR BRANCHES "${BRANCHES} + 1")
+            endif()
+        endif()
+    endif()
+endforeach()
+check_function()
+
+if(PROBES EQUAL 0)
+    message(FATAL_ERROR "no probe functions found in ${OBJECT}")
+endif()
+
+if(FAILED GREATER 0)
+    message(FATAL_ERROR "${FAILED} of ${PROBES} probes regressed")
+endif()
+
+message(STATUS "all ${PROBES} probes ok")
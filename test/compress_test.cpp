@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/bulk.hpp"
+#include "cxxendian/compress.hpp"
+#include "check.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using endian::Order;
+using endian::Pack_Mode;
+
+template <typename T>
+static std::vector<T> random_values(std::size_t n, std::uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<T>  v(n);
+    for (auto &x : v)
+        x = static_cast<T>(rng());
+    return v;
+}
+
+// pack from one byte order, unpack to both byte orders
+template <Order order, typename T>
+static void check_round_trip(const std::vector<T> &host, Pack_Mode mode) {
+    const std::size_t         n = host.size();
+    std::vector<std::uint8_t> wire(n * sizeof(T) + 1), packed(endian::max_packed_size<T>(n) + 1, 0xEE);
+    endian::from_host_n<order>(host.data(), wire.data(), n);
+
+    const std::size_t size = endian::pack_n<order, T>(wire.data(), n, packed.data(), mode);
+    CHECK(size <= endian::max_packed_size<T>(n));
+    CHECK(packed[endian::max_packed_size<T>(n)] == 0xEE);
+
+    std::vector<std::uint8_t> out(n * sizeof(T) + 1);
+    std::size_t               consumed = size + 1;
+    CHECK((endian::unpack_n<order, T>(packed.data(), size, out.data(), n, mode, consumed) && consumed == size));
+    CHECK(std::memcmp(out.data(), wire.data(), n * sizeof(T)) == 0);
+
+    constexpr Order other = order == Order::Big ? Order::Little : Order::Big;
+    std::vector<T>  back(n);
+    consumed = size + 1;
+    CHECK((endian::unpack_n<other, T>(packed.data(), size, out.data(), n, mode, consumed) && consumed == size));
+    endian::to_host_n<other>(out.data(), back.data(), n);
+    CHECK(back == host);
+
+    // the format does not depend on the byte order of the input
+    std::vector<std::uint8_t> wire2(n * sizeof(T) + 1), packed2(endian::max_packed_size<T>(n) + 1);
+    endian::from_host_n<other>(host.data(), wire2.data(), n);
+    CHECK((endian::pack_n<other, T>(wire2.data(), n, packed2.data(), mode) == size));
+    CHECK(std::memcmp(packed.data(), packed2.data(), size) == 0);
+}
+
+template <typename T>
+static void check_type() {
+    for (const std::size_t n : {0, 1, 2, 15, 16, 17, 127, 128, 129, 1000}) {
+        for (const Pack_Mode mode : {Pack_Mode::For, Pack_Mode::Delta}) {
+            const auto v = random_values<T>(n, n);
+            check_round_trip<Order::Big, T>(v, mode);
+            check_round_trip<Order::Little, T>(v, mode);
+
+            // few bits
+            std::vector<T> small(n);
+            for (std::size_t i = 0; i < n; ++i)
+                small[i] = static_cast<T>(static_cast<T>(i % 7) - 3);
+            check_round_trip<Order::Big, T>(small, mode);
+            check_round_trip<Order::Little, T>(small, mode);
+        }
+    }
+
+    // extreme values
+    const std::vector<T> extreme = {std::numeric_limits<T>::min(),
+                                    std::numeric_limits<T>::max(),
+                                    T(0),
+                                    std::numeric_limits<T>::max(),
+                                    std::numeric_limits<T>::min()};
+    check_round_trip<Order::Big, T>(extreme, Pack_Mode::For);
+    check_round_trip<Order::Big, T>(extreme, Pack_Mode::Delta);
+
+    // delta conversion
+    const auto                v = random_values<T>(777, 3);
+    std::vector<std::uint8_t> wire(v.size() * sizeof(T)), out(v.size() * sizeof(T));
+    endian::from_host_n<Order::Big>(v.data(), wire.data(), v.size());
+    std::vector<std::make_unsigned_t<T>> deltas(v.size());
+    endian::delta_encode_n<Order::Big, T>(wire.data(), deltas.data(), v.size());
+    bool ok = deltas[0] == static_cast<std::make_unsigned_t<T>>(v[0]);
+    for (std::size_t i = 1; i < v.size(); ++i)
+        ok = ok && deltas[i] == static_cast<std::make_unsigned_t<T>>(static_cast<std::make_unsigned_t<T>>(v[i]) -
+                                                                      static_cast<std::make_unsigned_t<T>>(v[i - 1]));
+    CHECK(ok);
+    endian::delta_decode_n<Order::Little, T>(deltas.data(), out.data(), v.size());
+    std::vector<T> back(v.size());
+    endian::little_to_host_n(out.data(), back.data(), v.size());
+    CHECK(back == v);
+}
+
+int main() {
+    check_type<std::uint8_t>();
+    check_type<std::int8_t>();
+    check_type<std::uint16_t>();
+    check_type<std::int16_t>();
+    check_type<std::uint32_t>();
+    check_type<std::int32_t>();
+    check_type<std::uint64_t>();
+    check_type<std::int64_t>();
+
+    // monotonic big endian timestamps: delta packing stores the jitter only
+    {
+        constexpr std::size_t      N = 4096;
+        std::vector<std::uint64_t> ts(N);
+        std::mt19937               rng(7);
+        std::uint64_t              t = 1666000000000000000ull;
+        for (auto &x : ts)
+            x = t += 1000000 + rng() % 1000;
+        std::vector<std::uint8_t> wire(N * 8), packed(endian::max_packed_size<std::uint64_t>(N));
+        endian::host_to_big_n(ts.data(), wire.data(), N);
+
+        const auto        pack  = endian::pack_n<Order::Big, std::uint64_t>;
+        const std::size_t delta = pack(wire.data(), N, packed.data(), Pack_Mode::Delta);
+        const std::size_t fr    = pack(wire.data(), N, packed.data(), Pack_Mode::For);
+        CHECK(delta <= 8 + N / endian::PACK_BLOCK * 9 + N * 10 / 8);
+        CHECK(fr < N * 8);
+        CHECK(delta < fr);
+    }
+
+    // constant step: no payload
+    {
+        constexpr std::size_t      N = 1000;
+        std::vector<std::uint32_t> v(N);
+        for (std::size_t i = 0; i < N; ++i)
+            v[i] = static_cast<std::uint32_t>(100 + 5 * i);
+        std::vector<std::uint8_t> wire(N * 4), packed(endian::max_packed_size<std::uint32_t>(N));
+        endian::host_to_little_n(v.data(), wire.data(), N);
+        const std::size_t size =
+                endian::pack_n<Order::Little, std::uint32_t>(wire.data(), N, packed.data(), Pack_Mode::Delta);
+        // first value, then per block only the reference 5
+        CHECK(packed[0] == 100 && packed[4] == 5 && packed[8] == 0);
+        CHECK(size == 4 + 8 * 5);
+    }
+
+    // truncated or invalid input
+    {
+        const auto                v = random_values<std::uint16_t>(300, 9);
+        std::vector<std::uint8_t> wire(600), out(600), packed(endian::max_packed_size<std::uint16_t>(300));
+        endian::host_to_big_n(v.data(), wire.data(), 300);
+        const auto        unpack = endian::unpack_n<Order::Big, std::uint16_t>;
+        const std::size_t size =
+                endian::pack_n<Order::Big, std::uint16_t>(wire.data(), 300, packed.data(), Pack_Mode::For);
+        std::size_t       consumed = 0;
+        CHECK(!unpack(packed.data(), size - 1, out.data(), 300, Pack_Mode::For, consumed));
+        CHECK(!unpack(packed.data(), 2, out.data(), 300, Pack_Mode::For, consumed));
+        CHECK(!unpack(packed.data(), 1, out.data(), 1, Pack_Mode::Delta, consumed));
+        packed[2] = 17;  // more bits than the type has
+        CHECK(!unpack(packed.data(), size, out.data(), 300, Pack_Mode::For, consumed));
+        CHECK(consumed == 0);
+    }
+
+    // empty stream: valid for both modes, distinguishable from an error
+    {
+        std::uint8_t packed[1] = {0xEE}, out[1] = {0xEE};
+        for (const Pack_Mode mode : {Pack_Mode::For, Pack_Mode::Delta}) {
+            CHECK((endian::pack_n<Order::Big, std::int32_t>(out, 0, packed, mode) == 0));
+            std::size_t consumed = 1;
+            CHECK((endian::unpack_n<Order::Big, std::int32_t>(packed, 0, out, 0, mode, consumed) && consumed == 0));
+            CHECK(packed[0] == 0xEE && out[0] == 0xEE);
+        }
+    }
+
+    return test_result();
+}
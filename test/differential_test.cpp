@@ -0,0 +1,547 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+/*
+ * Randomized differential test: every bulk conversion path is compared against the scalar reference endian::swap for
+ * all element widths, alignments 0..63, lengths from 0 to several MiB (odd tails) and both byte orders.
+ * All LE_* / BE_* / Host_* combinations are checked against an independent byte reversal, including NaN payloads.
+ *
+ * usage: test_cxxendian_differential [seed | random]
+ * Without an argument the fixed DEFAULT_SEED is used, so ctest runs are reproducible. The seed can also be set with the
+ * environment variable CXXENDIAN_TEST_SEED (the argument takes precedence); "random" draws it from std::random_device.
+ * The seed is printed if a check fails.
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/bulk.hpp"
+#include "cxxendian/convert.hpp"
+#include "cxxendian/packed.hpp"
+#include "cxxendian/stream.hpp"
+#include "cxxendian/strided.hpp"
+#include "check.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+static std::mt19937_64 rng;
+
+//* seed of runs without an explicit seed
+static constexpr std::uint64_t DEFAULT_SEED = 0x5EED;
+
+static std::uint64_t parse_seed(const char *arg) {
+    if (!arg) return DEFAULT_SEED;
+    if (std::string(arg) == "random") return std::random_device()();
+    return std::strtoull(arg, nullptr, 0);
+}
+
+//* print context of the first failures only
+static void fail(const std::string &what, std::size_t width, std::size_t offset, std::size_t n) {
+    if (failed < 20)
+        std::cerr << "check failed: " << what << " (width " << width << ", offset " << offset << ", n " << n << ')'
+                  << std::endl;
+    ++failed;
+}
+
+#define CHECK_AT(expr, what, width, offset, n)                                                                         \
+    do {                                                                                                               \
+        if (!(expr)) fail(what, width, offset, n);                                                                     \
+    } while (0)
+
+//* guard bytes around every output buffer
+static constexpr std::size_t GUARD = 64;
+
+//* value of untouched output bytes
+static constexpr std::uint8_t FILL = 0xCD;
+
+/**
+ * @brief buffer with guard bytes and a configurable misalignment
+ */
+class Buffer {
+    std::vector<std::uint8_t> storage;
+    std::uint8_t             *base;  // aligned to 64
+    std::size_t               offset;
+    std::size_t               bytes;
+
+public:
+    Buffer(std::size_t size, std::size_t misalignment)
+        : storage(size + 2 * GUARD + 128, FILL), offset(misalignment), bytes(size) {
+        const auto addr = reinterpret_cast<std::uintptr_t>(storage.data() + GUARD);
+        base            = storage.data() + GUARD + ((64 - addr % 64) % 64);
+    }
+
+    std::uint8_t *data() { return base + offset; }
+
+    void randomize() {
+        for (std::size_t i = 0; i < bytes; i += sizeof(std::uint64_t)) {
+            const std::uint64_t r = rng();
+            std::memcpy(data() + i, &r, std::min(sizeof(r), bytes - i));
+        }
+    }
+
+    //* true if all bytes outside of [data(), data() + size) are unchanged
+    bool guards_intact() const {
+        const std::uint8_t *begin = base + offset;
+        const std::uint8_t *end   = begin + bytes;
+        return std::all_of(storage.data(), begin, [](std::uint8_t b) { return b == FILL; }) &&
+               std::all_of(end, storage.data() + storage.size(), [](std::uint8_t b) { return b == FILL; });
+    }
+};
+
+//* reference: swap every element with the scalar endian::swap
+template <typename T>
+static void reference_swap(const std::uint8_t *src, std::uint8_t *dst, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        T v;
+        std::memcpy(&v, src + i * sizeof(T), sizeof(T));
+        v = endian::swap(v);
+        std::memcpy(dst + i * sizeof(T), &v, sizeof(T));
+    }
+}
+
+//* reference: convert between byte order order and host endian
+template <endian::Order order, typename T>
+static void reference_convert(const std::uint8_t *src, std::uint8_t *dst, std::size_t n) {
+    if (order == endian::HostOrder) {
+        if (n) std::memcpy(dst, src, n * sizeof(T));
+    } else {
+        reference_swap<T>(src, dst, n);
+    }
+}
+
+/**
+ * @brief run one bulk conversion path and compare the result with the reference
+ * @param name name of the path
+ * @param src_offset misalignment of the input
+ * @param dst_offset misalignment of the output
+ * @param n number of elements
+ * @param swap true if the path swaps unconditionally (swap_n), false if it converts from/to byte order order
+ * @param f conversion: f(src, dst, n)
+ */
+template <endian::Order order, typename T, typename F>
+static void check_path(const char *name, std::size_t src_offset, std::size_t dst_offset, std::size_t n, bool swap, F f) {
+    const std::size_t bytes = n * sizeof(T);
+    Buffer            src(bytes, src_offset);
+    Buffer            dst(bytes, dst_offset);
+    src.randomize();
+
+    std::vector<std::uint8_t> expected(bytes);
+    if (swap) reference_swap<T>(src.data(), expected.data(), n);
+    else reference_convert<order, T>(src.data(), expected.data(), n);
+
+    f(src.data(), dst.data(), n);
+    CHECK_AT(bytes == 0 || std::memcmp(dst.data(), expected.data(), bytes) == 0, name, sizeof(T), src_offset, n);
+    CHECK_AT(dst.guards_intact(), std::string(name) + ": write out of bounds", sizeof(T), src_offset, n);
+
+    // in place
+    Buffer inplace(bytes, dst_offset);
+    if (bytes) std::memcpy(inplace.data(), src.data(), bytes);
+    f(inplace.data(), inplace.data(), n);
+    CHECK_AT(bytes == 0 || std::memcmp(inplace.data(), expected.data(), bytes) == 0,
+             std::string(name) + " (in place)",
+             sizeof(T),
+             dst_offset,
+             n);
+}
+
+template <typename T>
+static T *as(std::uint8_t *p) {
+    return reinterpret_cast<T *>(p);
+}
+
+template <typename T>
+static const T *as_const(std::uint8_t *p) {
+    return reinterpret_cast<const T *>(p);
+}
+
+/**
+ * @brief all contiguous bulk paths for one type, byte order, alignment and length
+ * @details The void * side of a conversion may have any misalignment, the T * side is aligned for T.
+ */
+template <endian::Order order, typename T>
+static void check_contiguous(std::size_t offset, std::size_t n) {
+    const std::size_t t_offset = offset / sizeof(T) * sizeof(T);
+
+    check_path<order, T>("swap_n", t_offset, t_offset, n, true, [](std::uint8_t *s, std::uint8_t *d, std::size_t m) {
+        endian::swap_n(as_const<T>(s), as<T>(d), m);
+    });
+    check_path<order, T>("swap_n non_temporal", t_offset, 0, n, true, [](std::uint8_t *s, std::uint8_t *d, std::size_t m) {
+        endian::swap_n(as_const<T>(s), as<T>(d), m, endian::non_temporal);
+    });
+    check_path<order, T>("to_host_n", offset, t_offset, n, false, [](std::uint8_t *s, std::uint8_t *d, std::size_t m) {
+        endian::to_host_n<order>(s, as<T>(d), m);
+    });
+    check_path<order, T>(
+            "to_host_n non_temporal", offset, t_offset, n, false, [](std::uint8_t *s, std::uint8_t *d, std::size_t m) {
+                endian::to_host_n<order>(s, as<T>(d), m, endian::non_temporal);
+            });
+    check_path<order, T>("from_host_n", t_offset, offset, n, false, [](std::uint8_t *s, std::uint8_t *d, std::size_t m) {
+        endian::from_host_n<order>(as_const<T>(s), d, m);
+    });
+    check_path<order, T>(
+            "from_host_n non_temporal", t_offset, offset, n, false, [](std::uint8_t *s, std::uint8_t *d, std::size_t m) {
+                endian::from_host_n<order>(as_const<T>(s), d, m, endian::non_temporal);
+            });
+    check_path<order, T>(
+            "to_host_convert_n", offset, t_offset, n, false, [](std::uint8_t *s, std::uint8_t *d, std::size_t m) {
+                endian::to_host_convert_n<order, T>(s, as<T>(d), m);
+            });
+    check_path<order, T>(
+            "from_host_convert_n", t_offset, offset, n, false, [](std::uint8_t *s, std::uint8_t *d, std::size_t m) {
+                endian::from_host_convert_n<order, T>(as_const<T>(s), d, m);
+            });
+    check_path<order, T>(
+            "to_host_strided_n", offset, t_offset, n, false, [](std::uint8_t *s, std::uint8_t *d, std::size_t m) {
+                endian::to_host_strided_n<order>(s, sizeof(T), as<T>(d), m);
+            });
+    check_path<order, T>(
+            "from_host_strided_n", t_offset, offset, n, false, [](std::uint8_t *s, std::uint8_t *d, std::size_t m) {
+                endian::from_host_strided_n<order>(as_const<T>(s), d, sizeof(T), m);
+            });
+
+    if (offset == 0) {
+        check_path<order, T>("swap_n assume_aligned", 0, 0, n, true, [](std::uint8_t *s, std::uint8_t *d, std::size_t m) {
+            endian::swap_n(as_const<T>(s), as<T>(d), m, endian::assume_aligned);
+        });
+        check_path<order, T>(
+                "to_host_n assume_aligned", 0, 0, n, false, [](std::uint8_t *s, std::uint8_t *d, std::size_t m) {
+                    endian::to_host_n<order>(s, as<T>(d), m, endian::assume_aligned);
+                });
+        check_path<order, T>(
+                "from_host_n assume_aligned", 0, 0, n, false, [](std::uint8_t *s, std::uint8_t *d, std::size_t m) {
+                    endian::from_host_n<order>(as_const<T>(s), d, m, endian::assume_aligned);
+                });
+    }
+}
+
+/**
+ * @brief streaming paths (src and dst must not overlap: no in place check)
+ */
+template <endian::Order order, typename T>
+static void check_stream(std::size_t offset, std::size_t n) {
+    const std::size_t bytes    = n * sizeof(T);
+    const std::size_t t_offset = offset / sizeof(T) * sizeof(T);
+
+    endian::Stream_Params small;
+    small.block_bytes       = 256;
+    small.prefetch_distance = 512;
+    small.non_temporal      = (n & 1) != 0;
+
+    for (const auto &params : {endian::Stream_Params {}, small}) {
+        Buffer src(bytes, offset);
+        Buffer dst(bytes, t_offset);
+        src.randomize();
+        std::vector<std::uint8_t> expected(bytes);
+        reference_convert<order, T>(src.data(), expected.data(), n);
+
+        endian::to_host_stream_n<order>(src.data(), as<T>(dst.data()), n, params);
+        CHECK_AT(bytes == 0 || std::memcmp(dst.data(), expected.data(), bytes) == 0, "to_host_stream_n", sizeof(T), offset, n);
+        CHECK_AT(dst.guards_intact(), "to_host_stream_n: write out of bounds", sizeof(T), offset, n);
+
+        Buffer out(bytes, offset);
+        endian::from_host_stream_n<order>(as_const<T>(src.data()), out.data(), n, params);
+        reference_convert<order, T>(src.data(), expected.data(), n);
+        CHECK_AT(bytes == 0 || std::memcmp(out.data(), expected.data(), bytes) == 0, "from_host_stream_n", sizeof(T), offset, n);
+        CHECK_AT(out.guards_intact(), "from_host_stream_n: write out of bounds", sizeof(T), offset, n);
+    }
+}
+
+/**
+ * @brief strided and indexed paths with random strides/offsets
+ */
+template <endian::Order order, typename T>
+static void check_gather(std::size_t offset, std::size_t n) {
+    const std::size_t stride = sizeof(T) + rng() % 13;
+    const std::size_t bytes  = n ? (n - 1) * stride + sizeof(T) : 0;
+
+    Buffer records(bytes, offset);
+    records.randomize();
+
+    // expected: element i at records + i * stride
+    std::vector<std::uint8_t> packed(n * sizeof(T));
+    for (std::size_t i = 0; i < n; ++i)
+        std::memcpy(packed.data() + i * sizeof(T), records.data() + i * stride, sizeof(T));
+    std::vector<std::uint8_t> expected(n * sizeof(T));
+    reference_convert<order, T>(packed.data(), expected.data(), n);
+
+    Buffer column(n * sizeof(T), 0);
+    endian::to_host_strided_n<order>(records.data(), stride, as<T>(column.data()), n);
+    CHECK_AT(n == 0 || std::memcmp(column.data(), expected.data(), n * sizeof(T)) == 0,
+             "to_host_strided_n (stride " + std::to_string(stride) + ')',
+             sizeof(T),
+             offset,
+             n);
+    CHECK_AT(column.guards_intact(), "to_host_strided_n: write out of bounds", sizeof(T), offset, n);
+
+    // back to records: bytes between the elements must not be modified
+    Buffer out(bytes, offset);
+    if (bytes) std::memcpy(out.data(), records.data(), bytes);
+    endian::from_host_strided_n<order>(as_const<T>(column.data()), out.data(), stride, n);
+    CHECK_AT(bytes == 0 || std::memcmp(out.data(), records.data(), bytes) == 0,
+             "from_host_strided_n (stride " + std::to_string(stride) + ')',
+             sizeof(T),
+             offset,
+             n);
+    CHECK_AT(out.guards_intact(), "from_host_strided_n: write out of bounds", sizeof(T), offset, n);
+
+    // gather in random order
+    std::vector<std::int32_t> offsets(n);
+    for (std::size_t i = 0; i < n; ++i)
+        offsets[i] = static_cast<std::int32_t>(i * stride);
+    std::shuffle(offsets.begin(), offsets.end(), rng);
+
+    Buffer gathered(n * sizeof(T), 0);
+    endian::to_host_gather_n<order>(records.data(), offsets.data(), as<T>(gathered.data()), n);
+    for (std::size_t i = 0; i < n; ++i) {
+        std::uint8_t ref[sizeof(T)];
+        reference_convert<order, T>(records.data() + offsets[i], ref, 1);
+        CHECK_AT(std::memcmp(gathered.data() + i * sizeof(T), ref, sizeof(T)) == 0, "to_host_gather_n", sizeof(T), offset, n);
+    }
+    CHECK_AT(gathered.guards_intact(), "to_host_gather_n: write out of bounds", sizeof(T), offset, n);
+
+    Buffer scattered(bytes, offset);
+    if (bytes) std::memcpy(scattered.data(), records.data(), bytes);
+    endian::from_host_scatter_n<order>(as_const<T>(gathered.data()), scattered.data(), offsets.data(), n);
+    CHECK_AT(bytes == 0 || std::memcmp(scattered.data(), records.data(), bytes) == 0,
+             "from_host_scatter_n",
+             sizeof(T),
+             offset,
+             n);
+    CHECK_AT(scattered.guards_intact(), "from_host_scatter_n: write out of bounds", sizeof(T), offset, n);
+}
+
+template <endian::Order order, typename T>
+static void check_bulk() {
+    // all vector widths +- 1, with odd tails
+    static constexpr std::size_t LENGTHS[] = {0,  1,  2,  3,  4,  5,  6,  7,   8,   9,   15,  16,  17,  31,   32,
+                                              33, 47, 63, 64, 65, 95, 127, 128, 129, 255, 257, 511, 1000, 4099};
+
+    for (std::size_t offset = 0; offset < 64; ++offset) {
+        for (std::size_t n : LENGTHS)
+            check_contiguous<order, T>(offset, n);
+        const std::size_t n = LENGTHS[rng() % (sizeof(LENGTHS) / sizeof(LENGTHS[0]))];
+        check_stream<order, T>(offset, n);
+        check_gather<order, T>(offset, n);
+    }
+
+    // several MiB with odd tails (one size above CXXENDIAN_STREAM_THRESHOLD: non-temporal dispatch)
+    for (std::size_t bytes : {std::size_t(3) << 20, sizeof(T) == 4 ? CXXENDIAN_STREAM_THRESHOLD : 0}) {
+        if (!bytes) continue;
+        const std::size_t n      = bytes / sizeof(T) + 7;
+        const std::size_t offset = rng() % 64;
+        check_path<order, T>("to_host_n (large)", offset, 0, n, false, [](std::uint8_t *s, std::uint8_t *d, std::size_t m) {
+            endian::to_host_n<order>(s, as<T>(d), m);
+        });
+        check_path<order, T>("swap_n (large)", 0, sizeof(T), n, true, [](std::uint8_t *s, std::uint8_t *d, std::size_t m) {
+            endian::swap_n(as_const<T>(s), as<T>(d), m);
+        });
+        check_stream<order, T>(offset, n);
+    }
+}
+
+//* reference: value in byte order order (independent byte reversal)
+template <endian::Order order, typename T>
+static T to_order(T v) {
+    if (order == endian::HostOrder) return v;
+    std::uint8_t bytes[sizeof(T)];
+    std::memcpy(bytes, &v, sizeof(T));
+    std::reverse(bytes, bytes + sizeof(T));
+    std::memcpy(&v, bytes, sizeof(T));
+    return v;
+}
+
+template <typename T>
+static bool same_bits(T a, T b) {
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+// stored representation (floating point types store the bit pattern in an unsigned integer) equals the wire value
+template <typename R, typename T>
+static bool same_raw(R raw, T wire) {
+    static_assert(sizeof(R) == sizeof(T), "representation size mismatch");
+    return std::memcmp(&raw, &wire, sizeof(T)) == 0;
+}
+
+template <template <typename> class E>
+struct Order_Of;
+
+template <>
+struct Order_Of<cxxendian::LE_Int> {
+    static constexpr endian::Order value = endian::Order::Little;
+};
+
+template <>
+struct Order_Of<cxxendian::BE_Int> {
+    static constexpr endian::Order value = endian::Order::Big;
+};
+
+template <>
+struct Order_Of<cxxendian::Host_Int> {
+    static constexpr endian::Order value = endian::HostOrder;
+};
+
+template <>
+struct Order_Of<cxxendian::LE_Float> {
+    static constexpr endian::Order value = endian::Order::Little;
+};
+
+template <>
+struct Order_Of<cxxendian::BE_Float> {
+    static constexpr endian::Order value = endian::Order::Big;
+};
+
+template <>
+struct Order_Of<cxxendian::Host_Float> {
+    static constexpr endian::Order value = endian::HostOrder;
+};
+
+/**
+ * @brief construct X from v, convert to Y in all possible ways and check value and stored bytes
+ */
+template <template <typename> class X, template <typename> class Y, typename T>
+static void check_type_pair(T v) {
+    constexpr auto x_order = Order_Of<X>::value;
+    constexpr auto y_order = Order_Of<Y>::value;
+
+    X<T> x(v);
+    CHECK_AT(same_bits(x.get(), v), "X(v).get()", sizeof(T), 0, 1);
+    CHECK_AT(same_raw(x.get_raw(), to_order<x_order>(v)), "X(v).get_raw()", sizeof(T), 0, 1);
+
+    Y<T> y(x);
+    CHECK_AT(same_bits(y.get(), v), "Y(X).get()", sizeof(T), 0, 1);
+    CHECK_AT(same_raw(y.get_raw(), to_order<y_order>(v)), "Y(X).get_raw()", sizeof(T), 0, 1);
+
+    Y<T> moved(X<T>(x.get()));
+    CHECK_AT(same_bits(moved.get(), v), "Y(X&&).get()", sizeof(T), 0, 1);
+
+    Y<T> assigned(T {});
+    assigned = x;
+    CHECK_AT(same_bits(assigned.get(), v), "Y = X", sizeof(T), 0, 1);
+    assigned = X<T>(v);
+    CHECK_AT(same_bits(assigned.get(), v), "Y = X&&", sizeof(T), 0, 1);
+
+    Y<T> from_value(T {});
+    from_value = v;
+    CHECK_AT(same_bits(from_value.get(), v), "Y = v", sizeof(T), 0, 1);
+    CHECK_AT(same_raw(from_value.get_raw(), to_order<y_order>(v)), "(Y = v).get_raw()", sizeof(T), 0, 1);
+
+    cxxendian::Packed<T, x_order> packed(v);
+    CHECK_AT(same_bits(packed.get(), v), "Packed(v).get()", sizeof(T), 0, 1);
+    const T wire = to_order<x_order>(v);
+    CHECK_AT(std::memcmp(packed.data(), &wire, sizeof(T)) == 0, "Packed(v).data()", sizeof(T), 0, 1);
+}
+
+template <template <typename> class X, typename T>
+static void check_types_from(T v) {
+    if constexpr (std::is_integral<T>::value) {
+        check_type_pair<X, cxxendian::LE_Int>(v);
+        check_type_pair<X, cxxendian::BE_Int>(v);
+        check_type_pair<X, cxxendian::Host_Int>(v);
+    } else {
+        check_type_pair<X, cxxendian::LE_Float>(v);
+        check_type_pair<X, cxxendian::BE_Float>(v);
+        check_type_pair<X, cxxendian::Host_Float>(v);
+    }
+}
+
+template <typename T>
+static T random_value() {
+    using U = typename endian::detail::Uint_Of<sizeof(T)>::type;
+    const U u = static_cast<U>(rng());
+    T       v;
+    std::memcpy(&v, &u, sizeof(T));
+    return v;
+}
+
+template <typename T>
+static void check_types() {
+    std::vector<T> values;
+    for (int i = 0; i < 1000; ++i)
+        values.push_back(random_value<T>());
+
+    if constexpr (std::is_floating_point<T>::value) {
+        // signaling and quiet NaNs with payload, infinities, denormals, negative zero
+        using U                   = typename endian::detail::Uint_Of<sizeof(T)>::type;
+        constexpr unsigned BITS   = sizeof(T) * 8;
+        constexpr unsigned MANT   = sizeof(T) == 4 ? 23 : 52;
+        const U            exp    = static_cast<U>((U(1) << (BITS - 1)) - (U(1) << MANT));
+        const U            quiet  = static_cast<U>(U(1) << (MANT - 1));
+        const U            sign   = static_cast<U>(U(1) << (BITS - 1));
+        const U            bits[] = {static_cast<U>(exp | 1),
+                                     static_cast<U>(exp | 0x2A5),
+                                     static_cast<U>(exp | quiet | 0x1234),
+                                     static_cast<U>(sign | exp | 0x55),
+                                     exp,
+                                     1,
+                                     sign};
+        for (U b : bits) {
+            T v;
+            std::memcpy(&v, &b, sizeof(T));
+            values.push_back(v);
+        }
+    }
+
+    for (T v : values) {
+        if constexpr (std::is_integral<T>::value) {
+            check_types_from<cxxendian::LE_Int>(v);
+            check_types_from<cxxendian::BE_Int>(v);
+            check_types_from<cxxendian::Host_Int>(v);
+        } else {
+            check_types_from<cxxendian::LE_Float>(v);
+            check_types_from<cxxendian::BE_Float>(v);
+            check_types_from<cxxendian::Host_Float>(v);
+        }
+    }
+
+    // bulk conversion of NaN payloads
+    if constexpr (std::is_floating_point<T>::value) {
+        const std::size_t         n = values.size();
+        std::vector<std::uint8_t> wire(n * sizeof(T));
+        std::vector<T>            back(n);
+        endian::from_host_n<endian::Order::Big>(values.data(), wire.data(), n);
+        endian::to_host_n<endian::Order::Big>(wire.data(), back.data(), n);
+        CHECK_AT(std::memcmp(values.data(), back.data(), n * sizeof(T)) == 0, "NaN payload round trip", sizeof(T), 0, n);
+    }
+}
+
+template <typename T>
+static void check_all() {
+    check_bulk<endian::Order::Big, T>();
+    check_bulk<endian::Order::Little, T>();
+    check_types<T>();
+}
+
+int main(int argc, char **argv) {
+    const std::uint64_t seed = parse_seed(argc > 1 ? argv[1] : std::getenv("CXXENDIAN_TEST_SEED"));
+    rng.seed(seed);
+
+    // scalar reference against an independent byte reversal
+    for (int i = 0; i < 10000; ++i) {
+        const auto v = random_value<std::uint64_t>();
+        CHECK_AT(endian::swap(v) == to_order<endian::Order::Big>(v) || endian::HostOrder == endian::Order::Big,
+                 "endian::swap",
+                 8,
+                 0,
+                 1);
+        const auto w = random_value<std::uint16_t>();
+        CHECK_AT(endian::swap(endian::swap(w)) == w, "endian::swap (16 bit)", 2, 0, 1);
+    }
+
+    check_all<std::uint8_t>();
+    check_all<std::int16_t>();
+    check_all<std::uint32_t>();
+    check_all<std::int64_t>();
+    check_all<float>();
+    check_all<double>();
+
+    if (failed) std::cerr << "seed " << seed << std::endl;
+    return test_result();
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/file_convert.hpp"
+#include "check.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace cxxendian;
+
+// temporary file that is removed on destruction
+struct Temp_File {
+    std::string path;
+    int         fd;
+
+    Temp_File() {
+        char name[] = "/tmp/cxxendian_file_XXXXXX";
+        fd          = mkstemp(name);
+        path        = name;
+    }
+
+    ~Temp_File() {
+        close(fd);
+        unlink(path.c_str());
+    }
+
+    bool write(const std::vector<std::uint8_t> &data) const {
+        return ftruncate(fd, 0) == 0 &&
+               pwrite(fd, data.data(), data.size(), 0) == static_cast<ssize_t>(data.size());
+    }
+
+    std::vector<std::uint8_t> read() const {
+        std::vector<std::uint8_t> data(static_cast<std::size_t>(lseek(fd, 0, SEEK_END)));
+        if (pread(fd, data.data(), data.size(), 0) != static_cast<ssize_t>(data.size())) data.clear();
+        return data;
+    }
+};
+
+template <typename T>
+static void check(std::size_t bytes, const File_Convert_Params &params, bool in_place) {
+    std::vector<std::uint8_t> data(bytes);
+    for (std::size_t i = 0; i < bytes; ++i)
+        data[i] = static_cast<std::uint8_t>(i * 31 + i / 251);
+
+    std::vector<std::uint8_t> expected = data;
+    const std::size_t         n        = bytes / sizeof(T);
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t b = 0; b < sizeof(T); ++b)
+            expected[i * sizeof(T) + b] = data[i * sizeof(T) + sizeof(T) - 1 - b];
+
+    Temp_File in;
+    Temp_File out;
+    CHECK(in.fd >= 0 && out.fd >= 0 && in.write(data));
+
+    File_Convert_Stats stats;
+    CHECK(swap_file<T>(in.fd, in_place ? in.fd : out.fd, params, &stats));
+    CHECK(stats.bytes == bytes);
+    CHECK((in_place ? in : out).read() == expected);
+    if (bytes && params.use_io_uring && !stats.io_uring)
+        std::cout << "io_uring not available, pread/pwrite loop was used" << std::endl;
+}
+
+int main() {
+    for (bool uring : {true, false}) {
+        File_Convert_Params params;
+        params.use_io_uring = uring;
+        params.buffer_bytes = 4096;
+        params.queue_depth  = 4;
+
+        check<std::uint32_t>(0, params, false);
+        check<std::uint32_t>(4, params, false);
+        check<std::uint32_t>(100003, params, false);  // trailing bytes are copied
+        check<std::uint16_t>(65536, params, true);
+        check<std::uint64_t>(4096 * 9 + 8, params, true);
+
+        params.buffer_bytes = 3000;  // not a multiple of 16: rounded down
+        check<double>(123456, params, false);
+        check<__uint128_t>(4096 * 3, params, false);
+
+        params = File_Convert_Params();
+        params.use_io_uring = uring;
+        check<std::uint32_t>(std::size_t(5) << 20, params, false);
+
+        params.buffer_bytes = ~std::size_t(0);  // limited to the file size
+        check<std::uint16_t>(100002, params, false);
+    }
+
+    // errors: statistics are not modified
+    File_Convert_Params params;
+    File_Convert_Stats  stats {7, true};
+    CHECK(!swap_file<std::uint32_t>(-1, -1, params, &stats));
+    Temp_File in;
+    CHECK(in.write(std::vector<std::uint8_t>(4096)));
+    for (bool uring : {true, false}) {
+        params.use_io_uring = uring;
+        CHECK(!swap_file<std::uint32_t>(in.fd, -1, params, &stats));
+    }
+    CHECK(stats.bytes == 7 && stats.io_uring);
+
+    return test_result();
+}
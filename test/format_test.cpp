@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/columnar.hpp"
+#include "cxxendian/format.hpp"
+#include "cxxendian/packed.hpp"
+#include "check.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using endian::Order;
+
+template <typename... Args>
+static std::string chars(Args &&...args) {
+    char       buf[64];
+    const auto r = cxxendian::to_chars(buf, buf + sizeof(buf), args...);
+    return r.ec == std::errc() ? std::string(buf, r.ptr) : std::string("error");
+}
+
+template <typename Type>
+static std::string hex_chars(const Type &v) {
+    char       buf[64];
+    const auto r = cxxendian::to_chars_hex(buf, buf + sizeof(buf), v);
+    return r.ec == std::errc() ? std::string(buf, r.ptr) : std::string("error");
+}
+
+template <typename Type>
+static std::string streamed(const Type &v) {
+    std::ostringstream s;
+    s << v;
+    return s.str();
+}
+
+// reference implementation of the hexdump format
+static std::string reference_hexdump(const std::vector<std::uint8_t> &data, const endian::Field_Boundaries &fields) {
+    std::vector<bool> boundary(data.size());
+    for (std::size_t f = 0; f < fields.count; ++f) {
+        if (fields.stride == 0) {
+            if (fields.offsets[f] < data.size()) boundary[fields.offsets[f]] = true;
+        } else {
+            for (std::size_t p = fields.offsets[f] % fields.stride; p < data.size(); p += fields.stride)
+                boundary[p] = true;
+        }
+    }
+
+    std::string out;
+    char        buf[16];
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        if (i % 16 == 0) {
+            std::snprintf(buf, sizeof(buf), "%08x ", static_cast<unsigned>(i));
+            out += buf;
+        }
+        std::snprintf(buf, sizeof(buf), "%c%02x", boundary[i] ? '|' : ' ', data[i]);
+        out += buf;
+        if (i % 16 == 15 || i + 1 == data.size()) out += '\n';
+    }
+    return out;
+}
+
+static std::string dump(const std::vector<std::uint8_t> &data, const endian::Field_Boundaries &fields = {}) {
+    std::string       out(endian::hexdump_size(data.size()) + 1, '#');
+    const std::size_t n = endian::hexdump(data.data(), data.size(), &out[0], fields);
+    CHECK(n == endian::hexdump_size(data.size()));
+    CHECK(out.back() == '#');
+    out.resize(n);
+    return out;
+}
+
+int main() {
+    // logical value, not the stored byte pattern
+    {
+        const cxxendian::BE_Int<std::int32_t>    be(-123456);
+        const cxxendian::LE_Int<std::uint16_t>   le(0xBEEF);
+        const cxxendian::Host_Int<std::uint64_t> host(18446744073709551615ull);
+        CHECK(chars(be) == "-123456");
+        CHECK(chars(le) == "48879");
+        CHECK(chars(le, 16) == "beef");
+        CHECK(chars(host) == "18446744073709551615");
+        CHECK(chars(be, 16) == "-1e240");
+
+        CHECK(streamed(be) == "-123456");
+        CHECK(streamed(le) == "48879");
+        CHECK(streamed(cxxendian::BE_Int<std::uint32_t>(1)) == "1");
+
+        CHECK(hex_chars(be) == "fffe1dc0");
+        CHECK(hex_chars(le) == "beef");
+        CHECK(hex_chars(cxxendian::LE_Int<std::int16_t>(-2)) == "fffe");
+
+        // output too small
+        char       small[3];
+        const auto r = cxxendian::to_chars(small, small + sizeof(small), be);
+        CHECK(r.ec == std::errc::value_too_large);
+        CHECK(cxxendian::to_chars_hex(small, small + sizeof(small), be).ec == std::errc::value_too_large);
+    }
+
+    // floating point: shortest representation that is read back exactly
+    {
+        const cxxendian::BE_Float<double>  be(0.1);
+        const cxxendian::LE_Float<float>   le(-2.5f);
+        const cxxendian::Host_Float<float> host(1e-7f);
+        CHECK(endian::detail::to_bits(std::stod(chars(be))) == endian::detail::to_bits(0.1));
+        CHECK(endian::detail::to_bits(std::stof(chars(le))) == endian::detail::to_bits(-2.5f));
+        CHECK(endian::detail::to_bits(std::stof(chars(host))) == endian::detail::to_bits(1e-7f));
+        CHECK(hex_chars(cxxendian::LE_Float<float>(1.0f)) == "3f800000");
+        CHECK(hex_chars(cxxendian::BE_Float<double>(-2.0)) == "c000000000000000");
+    }
+
+    // packed types
+    {
+        const cxxendian::Packed_BE_Int<std::int16_t> pi(-300);
+        const cxxendian::Packed_LE_Float<double>     pf(0.25);
+        CHECK(chars(pi) == "-300");
+        CHECK(chars(pi, 16) == "-12c");
+        CHECK(chars(pf) == "0.25");
+        CHECK(hex_chars(pi) == "fed4");
+    }
+
+    // hex conversion of buffers (vector and tail)
+    {
+        std::mt19937 rng(5);
+        for (const std::size_t n : {0, 1, 15, 16, 17, 33, 100}) {
+            std::vector<std::uint8_t> data(n);
+            for (auto &b : data)
+                b = static_cast<std::uint8_t>(rng());
+            std::string out(2 * n + 1, '#'), expected;
+            endian::hex_n(data.data(), n, &out[0]);
+            char buf[3];
+            for (auto b : data) {
+                std::snprintf(buf, sizeof(buf), "%02x", b);
+                expected += buf;
+            }
+            CHECK(out.substr(0, 2 * n) == expected);
+            CHECK(out.back() == '#');
+        }
+    }
+
+    // hexdump
+    {
+        const std::vector<std::uint8_t> records = {0x00, 0x01, 0x00, 0x00, 0x12, 0x34, 0x00, 0x02, 0x00, 0x00,
+                                                   0x56, 0x78, 0x00, 0x03, 0x00, 0x00, 0x9a, 0xbc, 0x00, 0x04};
+        const std::size_t               offsets[] = {0, 2, 4};
+        CHECK(dump(records, {offsets, 3, 6}) == "00000000 |00 01|00 00|12 34|00 02|00 00|56 78|00 03|00 00\n"
+                                                "00000010 |9a bc|00 04\n");
+        CHECK(dump({}).empty());
+        CHECK(dump({0xAB}) == "00000000  ab\n");
+
+        std::mt19937 rng(11);
+        for (const std::size_t n : {1, 15, 16, 17, 31, 32, 100, 1000}) {
+            std::vector<std::uint8_t> data(n);
+            for (auto &b : data)
+                b = static_cast<std::uint8_t>(rng());
+            const std::size_t absolute[] = {0, 3, 16, 17, 31, 500};
+            const std::size_t relative[] = {7, 0, 5};
+            CHECK(dump(data) == reference_hexdump(data, {}));
+            CHECK(dump(data, {absolute, 6, 0}) == reference_hexdump(data, {absolute, 6, 0}));
+            CHECK(dump(data, {relative, 3, 9}) == reference_hexdump(data, {relative, 3, 9}));
+            CHECK(dump(data, {relative, 2, 40}) == reference_hexdump(data, {relative, 2, 40}));
+        }
+
+        // boundaries of a record codec
+        using Sample = cxxendian::Record_Codec<cxxendian::Field<cxxendian::BE_Int<std::uint16_t>, 0>,
+                                               cxxendian::Field<cxxendian::BE_Int<std::uint32_t>, 2>>;
+        const std::vector<std::uint8_t> samples = {0, 1, 0, 0, 0, 2, 0, 3, 0, 0, 0, 4};
+        CHECK(dump(samples, {Sample::offsets, 2, Sample::size}) == "00000000 |00 01|00 00 00 02|00 03|00 00 00 04\n");
+    }
+
+#if defined(CXXENDIAN_FMT)
+    // fmt: format specification of the base data type applied to the value
+    {
+        const cxxendian::BE_Int<std::int32_t>          be(-42);
+        const cxxendian::LE_Int<std::uint16_t>         le(0xBEEF);
+        const cxxendian::Base_Int<std::uint16_t>      &base = le;
+        const cxxendian::BE_Float<double>              f(1.5);
+        const cxxendian::Packed_BE_Int<std::uint32_t> pi(255);
+        CHECK(fmt::format("{}", be) == "-42");
+        CHECK(fmt::format("{:#06x}", le) == "0xbeef");
+        CHECK(fmt::format("{:>6}", base) == " 48879");
+        CHECK(fmt::format("{:.3f}", f) == "1.500");
+        CHECK(fmt::format("{:08b}", pi) == "11111111");
+        CHECK(fmt::format("{}", cxxendian::Host_Float<float>(0.5f)) == "0.5");
+    }
+#endif
+
+    return test_result();
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/bulk.hpp"
+#include "cxxendian/columnar.hpp"
+#include "cxxendian/incremental.hpp"
+#include "cxxendian/serialize.hpp"
+#include "check.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace cxxendian;
+
+// split data into random fragments (including empty ones)
+template <typename F>
+static void fragment(const std::vector<std::uint8_t> &data, std::mt19937 &rng, std::size_t max, F &&feed) {
+    std::size_t pos = 0;
+    while (pos < data.size()) {
+        const std::size_t n = std::min<std::size_t>(rng() % (max + 1), data.size() - pos);
+        feed(data.data() + pos, n);
+        pos += n;
+    }
+}
+
+int main() {
+    std::mt19937 rng(1234);
+
+    // values
+    for (std::size_t max_fragment : {1, 3, 7, 100, 5000}) {
+        std::vector<std::uint32_t> values(3000);
+        for (auto &v : values)
+            v = static_cast<std::uint32_t>(rng());
+
+        Writer<endian::Order::Big> w;
+        w.put_n(values.data(), values.size());
+        const std::vector<std::uint8_t> wire(w.data(), w.data() + w.size());
+
+        Incremental_Decoder<BE_Int<std::uint32_t>, 64> decoder;
+        std::vector<std::uint32_t>                      decoded;
+        bool                                            run_ok = true;
+        fragment(wire, rng, max_fragment, [&](const std::uint8_t *p, std::size_t n) {
+            decoder.feed(p, n, [&](const std::uint32_t *v, std::size_t count) {
+                run_ok = run_ok && count > 0 && count <= 64;
+                decoded.insert(decoded.end(), v, v + count);
+            });
+        });
+        CHECK(run_ok);
+        CHECK(decoded == values);
+        CHECK(decoder.pending() == 0);
+    }
+
+    // values are emitted as soon as they are complete
+    {
+        Incremental_Decoder<LE_Float<double>> decoder;
+        const double                          v = 1.5;
+        std::uint8_t                          wire[8];
+        endian::host_to_little_n(&v, wire, 1);
+
+        std::size_t emitted = 0;
+        auto        emit    = [&](const double *d, std::size_t n) { emitted += n * (equal_exact(d[0], 1.5) ? 1 : 100); };
+        decoder.feed(wire, 5, emit);
+        CHECK(emitted == 0 && decoder.pending() == 5);
+        decoder.feed(wire + 5, 3, emit);
+        CHECK(emitted == 1 && decoder.pending() == 0);
+
+        decoder.feed(wire, 2, emit);
+        decoder.reset();
+        decoder.feed(wire, 8, emit);
+        CHECK(emitted == 2);
+    }
+
+    // records
+    {
+        using Decoder = Incremental_Record_Decoder<Field<BE_Int<std::uint32_t>, 0>,
+                                                   Field<LE_Int<std::int16_t>, 4>,
+                                                   Field<BE_Float<float>, 6>>;
+        static_assert(Decoder::Codec::size == 10, "record size");
+
+        const std::size_t               n = 1000;
+        Writer<endian::Order::Big>      w;
+        std::vector<std::uint8_t>       wire;
+        for (std::size_t i = 0; i < n; ++i) {
+            w.put(static_cast<std::uint32_t>(i * 1000));
+            w.put(endian::swap(static_cast<std::int16_t>(-static_cast<int>(i))));
+            w.put(static_cast<float>(i) * 0.25f);
+        }
+        wire.assign(w.data(), w.data() + w.size());
+        if (endian::HostOrder == endian::Order::Big) {
+            // the int16 field is little endian: swap the written values back
+            for (std::size_t i = 0; i < n; ++i)
+                std::swap(wire[i * 10 + 4], wire[i * 10 + 5]);
+        }
+
+        for (std::size_t max_fragment : {1, 9, 11, 4000}) {
+            Decoder                    decoder;
+            std::vector<std::uint32_t> ids;
+            std::vector<std::int16_t>  deltas;
+            std::vector<float>         values;
+            fragment(wire, rng, max_fragment, [&](const std::uint8_t *p, std::size_t k) {
+                decoder.feed(p, k, [&](std::size_t count, const std::uint32_t *a, const std::int16_t *b, const float *c) {
+                    ids.insert(ids.end(), a, a + count);
+                    deltas.insert(deltas.end(), b, b + count);
+                    values.insert(values.end(), c, c + count);
+                });
+            });
+
+            bool ok = ids.size() == n && deltas.size() == n && values.size() == n;
+            for (std::size_t i = 0; ok && i < n; ++i)
+                ok = ids[i] == i * 1000 && deltas[i] == -static_cast<int>(i) && equal_exact(values[i], static_cast<float>(i) * 0.25f);
+            CHECK(ok);
+        }
+    }
+
+    return test_result();
+}
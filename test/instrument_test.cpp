@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/bulk.hpp"
+#include "cxxendian/columnar.hpp"
+#include "cxxendian/convert.hpp"
+#include "cxxendian/incremental.hpp"
+#include "cxxendian/instrument.hpp"
+#include "check.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace instrument = endian::instrument;
+
+static_assert(instrument::enabled, "test must be compiled with CXXENDIAN_INSTRUMENT");
+
+static instrument::Record find(const char *site, instrument::Direction direction, std::size_t width) {
+    instrument::Record found {site, direction, width, 0, 0, 0};
+    instrument::for_each([&](const instrument::Record &r) {
+        const bool same_site = site ? r.site && std::strcmp(r.site, site) == 0 : !r.site;
+        if (same_site && r.direction == direction && r.width == width) found = r;
+    });
+    return found;
+}
+
+static void decode(const std::uint8_t *buf, std::uint32_t *out, std::size_t n) {
+    CXXENDIAN_INSTRUMENT_SITE("decode");
+    endian::big_to_host_n(buf, out, n);
+}
+
+int main() {
+    using Direction = instrument::Direction;
+
+    instrument::reset();
+
+    // scalar conversions
+    std::uint16_t r16 = endian::host_to_big(std::uint16_t {0x1234});
+    r16               = endian::hb(r16);
+    CHECK(r16 == 0x1234);
+    static_cast<void>(endian::little_to_host(std::uint64_t {1}));
+
+    auto r = find(nullptr, Direction::Host_To_Big, 2);
+    CHECK(r.conversions == 2 && r.bytes == 4 && r.bulk_calls == 0);
+    r = find(nullptr, Direction::Little_To_Host, 8);
+    CHECK(r.conversions == 1 && r.bytes == 8);
+
+    // bulk conversions in several threads (counters of finished threads are kept)
+    std::uint8_t  wire[64 * 4] = {};
+    std::uint32_t host[64];
+    std::thread   workers[4];
+    for (auto &t : workers)
+        t = std::thread([&wire] {
+            std::uint32_t out[64];
+            for (int i = 0; i < 10; ++i)
+                endian::big_to_host_n(wire, out, 64);
+        });
+    for (auto &t : workers)
+        t.join();
+    endian::big_to_host_n(wire, host, 64);
+
+    r = find(nullptr, Direction::Big_To_Host, 4);
+    CHECK(r.bulk_calls == 41 && r.conversions == 41 * 64 && r.bytes == 41 * 64 * 4);
+
+    // composite bulk functions are counted once
+    float volts[64];
+    endian::to_host_convert_n<endian::Order::Little, std::int16_t>(wire, volts, 64, 1.f, 0.f);
+    r = find(nullptr, Direction::Little_To_Host, 2);
+    CHECK(r.bulk_calls == 1 && r.conversions == 64 && r.bytes == 128);
+
+    // record codec: one bulk call per field, also if the records are processed in several blocks
+    {
+        using Codec = cxxendian::Record_Codec<cxxendian::Field<cxxendian::LE_Int<std::uint16_t>, 0>,
+                                              cxxendian::Field<cxxendian::BE_Int<std::uint32_t>, 2>>;
+        constexpr std::size_t      records = 100000;
+        std::vector<std::uint8_t>  data(records * Codec::size);
+        std::vector<std::uint16_t> channels(records);
+        std::vector<std::uint32_t> values(records);
+        Codec::decode(data.data(), records, channels.data(), values.data());
+        Codec::encode(data.data(), records, channels.data(), values.data());
+        r = find(nullptr, Direction::Little_To_Host, 2);
+        CHECK(r.bulk_calls == 2 && r.conversions == 64 + records);
+        r = find(nullptr, Direction::Big_To_Host, 4);
+        CHECK(r.bulk_calls == 42 && r.conversions == 41 * 64 + records);
+        r = find(nullptr, Direction::Host_To_Little, 2);
+        CHECK(r.bulk_calls == 1 && r.conversions == records);
+        r = find(nullptr, Direction::Host_To_Big, 4);
+        CHECK(r.bulk_calls == 1 && r.conversions == records);
+
+        // incremental decoders: one bulk call per fragment
+        cxxendian::Incremental_Decoder<cxxendian::LE_Int<std::uint16_t>> decoder;
+        std::size_t                                                      emitted = 0;
+        decoder.feed(data.data(), 4097, [&](const std::uint16_t *, std::size_t n) { emitted += n; });
+        decoder.feed(data.data(), 1, [&](const std::uint16_t *, std::size_t n) { emitted += n; });
+        CHECK(emitted == 2049);
+        r = find(nullptr, Direction::Little_To_Host, 2);
+        CHECK(r.bulk_calls == 4 && r.conversions == 64 + records + 2049);
+
+        cxxendian::Incremental_Record_Decoder<cxxendian::Field<cxxendian::LE_Int<std::uint16_t>, 0>,
+                                              cxxendian::Field<cxxendian::BE_Int<std::uint32_t>, 2>>
+                    record_decoder;
+        std::size_t complete = 0;
+        record_decoder.feed(data.data(), 6000 * Codec::size, [&](std::size_t n, auto, auto) { complete += n; });
+        CHECK(complete == 6000);
+        r = find(nullptr, Direction::Big_To_Host, 4);
+        CHECK(r.bulk_calls == 43 && r.conversions == 41 * 64 + records + 6000);
+    }
+
+    // call sites
+    decode(wire, host, 16);
+    decode(wire, host, 8);
+    r = find("decode", Direction::Big_To_Host, 4);
+    CHECK(r.bulk_calls == 2 && r.conversions == 24);
+    r = find(nullptr, Direction::Big_To_Host, 4);
+    CHECK(r.bulk_calls == 45);
+
+    instrument::reset();
+    CHECK(find(nullptr, Direction::Big_To_Host, 4).conversions == 0);
+    CHECK(find("decode", Direction::Big_To_Host, 4).conversions == 0);
+
+    return test_result();
+}
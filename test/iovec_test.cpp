@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/iovec.hpp"
+#include "cxxendian/serialize.hpp"
+#include "check.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace cxxendian;
+
+struct Data {
+    std::uint16_t              id = 0;
+    std::vector<std::uint32_t> u32;
+    char                       name[5] {};
+    std::vector<double>        f64;
+    std::vector<std::int16_t>  i16;
+
+    explicit Data(std::size_t n) : u32(n), f64(n / 2 + 1), i16(n + 3) {}
+};
+
+static Data make_data(std::size_t n) {
+    Data d(n);
+    d.id = 0x0102;
+    for (std::size_t i = 0; i < d.u32.size(); ++i)
+        d.u32[i] = static_cast<std::uint32_t>(i * 0x01010101u + 7);
+    std::memcpy(d.name, "abcde", 5);
+    for (std::size_t i = 0; i < d.f64.size(); ++i)
+        d.f64[i] = static_cast<double>(i) * 0.5 - 3.0;
+    for (std::size_t i = 0; i < d.i16.size(); ++i)
+        d.i16[i] = static_cast<std::int16_t>(1000 - static_cast<int>(i) * 3);
+    return d;
+}
+
+template <endian::Order order>
+static void add_all(Iovec_Writer<order> &w, const Data &d) {
+    w.add(&d.id, 1);
+    w.add(d.u32.data(), d.u32.size());
+    w.add_bytes(d.name, sizeof(d.name));
+    w.add(d.f64.data(), d.f64.size());
+    w.add(d.i16.data(), d.i16.size());
+}
+
+template <endian::Order order>
+static void add_all(Iovec_Reader<order> &r, Data &d) {
+    r.add(&d.id, 1);
+    r.add(d.u32.data(), d.u32.size());
+    r.add_bytes(d.name, sizeof(d.name));
+    r.add(d.f64.data(), d.f64.size());
+    r.add(d.i16.data(), d.i16.size());
+}
+
+static bool equal(const Data &a, const Data &b) {
+    return a.id == b.id && a.u32 == b.u32 && std::memcmp(a.name, b.name, sizeof(a.name)) == 0 &&
+           std::memcmp(a.f64.data(), b.f64.data(), a.f64.size() * sizeof(double)) == 0 && a.i16 == b.i16;
+}
+
+// contiguous reference serialization
+template <endian::Order order>
+static std::vector<std::uint8_t> serialize(const Data &d) {
+    Writer<order> w;
+    w.put(d.id);
+    w.put_n(d.u32.data(), d.u32.size());
+    w.put_bytes(d.name, sizeof(d.name));
+    w.put_n(d.f64.data(), d.f64.size());
+    w.put_n(d.i16.data(), d.i16.size());
+    return std::vector<std::uint8_t>(w.data(), w.data() + w.size());
+}
+
+// transfer through memory with partial writes/reads of the given step size
+template <endian::Order order>
+static void check_loopback(std::size_t n, std::size_t step) {
+    const Data src = make_data(n);
+    Data       dst(n);
+
+    Iovec_Writer<order> w(64, 3, 4);  // small buffers: many batches
+    Iovec_Reader<order> r(3);
+    add_all(w, src);
+    add_all(r, dst);
+    CHECK(w.size() == r.size());
+
+    std::vector<std::uint8_t> wire;
+    while (!w.done()) {
+        const auto batch = w.next();
+        CHECK(batch.count > 0 && batch.count <= 4);
+
+        // "writev": at most step bytes
+        std::size_t written = 0;
+        for (int i = 0; i < batch.count && written < step; ++i) {
+            const auto *p = static_cast<const std::uint8_t *>(batch.iov[i].iov_base);
+            const auto  k = std::min(step - written, batch.iov[i].iov_len);
+            wire.insert(wire.end(), p, p + k);
+            written += k;
+        }
+        w.consume(written);
+    }
+    CHECK(wire == serialize<order>(src));
+
+    std::size_t pos = 0;
+    while (!r.done()) {
+        const auto batch = r.next();
+        CHECK(batch.count > 0 && batch.count <= 3);
+
+        // "readv": at most step bytes
+        std::size_t read = 0;
+        for (int i = 0; i < batch.count && read < step; ++i) {
+            const auto k = std::min(step - read, batch.iov[i].iov_len);
+            std::memcpy(batch.iov[i].iov_base, wire.data() + pos, k);
+            pos += k;
+            read += k;
+        }
+        r.consume(read);
+    }
+    CHECK(pos == wire.size());
+    CHECK(equal(src, dst));
+}
+
+int main() {
+    for (std::size_t step : {std::size_t(1), std::size_t(3), std::size_t(7), std::size_t(1000)}) {
+        check_loopback<endian::Order::Big>(100, step);
+        check_loopback<endian::Order::Little>(100, step);
+    }
+
+    // native segments are not copied
+    {
+        std::uint32_t                   values[4] = {1, 2, 3, 4};
+        Iovec_Writer<endian::HostOrder> w;
+        w.add(values, 4);
+        const auto batch = w.next();
+        CHECK(batch.count == 1 && batch.iov[0].iov_base == values && batch.iov[0].iov_len == sizeof(values));
+    }
+
+    // through a pipe (larger than the pipe buffer)
+    {
+        int fds[2];
+        CHECK(pipe(fds) == 0);
+        const Data src = make_data(100000);
+        Data       dst(100000);
+
+        std::thread writer([&] {
+            BE_Iovec_Writer w;
+            add_all(w, src);
+            CHECK(w.write_all(fds[1]));
+            close(fds[1]);
+        });
+
+        BE_Iovec_Reader r;
+        add_all(r, dst);
+        CHECK(r.read_all(fds[0]));
+        writer.join();
+        CHECK(equal(src, dst));
+
+        // end of file before all data was received
+        BE_Iovec_Reader eof;
+        std::uint32_t   v;
+        eof.add(&v, 1);
+        CHECK(!eof.read_all(fds[0]) && errno == 0);
+        close(fds[0]);
+    }
+
+    return test_result();
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/columnar.hpp"
+#include "cxxendian/packed.hpp"
+#include "check.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+using namespace cxxendian;
+
+struct Hdr {
+    Packed_BE_Int<std::uint16_t> type;
+    Packed_BE_Int<std::uint32_t> len;
+    Packed_LE_Float<double>      value;
+    Packed_BE_Int<std::int8_t>   flags;
+};
+
+static_assert(sizeof(Hdr) == 15, "packed struct must not contain padding");
+static_assert(alignof(Hdr) == 1, "packed struct must have alignment 1");
+static_assert(std::is_trivially_copyable<Hdr>::value, "packed struct must be trivially copyable");
+
+int main() {
+    const std::uint8_t rx[] = {0x12, 0x34, 0x00, 0x00, 0x01, 0x00, 0, 0, 0, 0, 0, 0, 0xF0, 0x3F, 0xFF, 0xAA};
+
+    // unaligned overlay
+    const auto *hdr = overlay<Hdr>(rx, sizeof(rx));
+    CHECK(hdr != nullptr);
+    if (hdr) {
+        CHECK(hdr->type.get() == 0x1234);
+        CHECK(hdr->len.get() == 0x100);
+        CHECK(equal_exact(hdr->value.get(), 1.0));
+        CHECK(hdr->flags.get() == -1);
+    }
+    CHECK(overlay<Hdr>(rx, sizeof(Hdr) - 1) == nullptr);
+    CHECK(&overlay<Hdr>(rx) == reinterpret_cast<const Hdr *>(rx));
+
+    // write through a mutable overlay
+    std::uint8_t tx[sizeof(Hdr)] = {};
+    Hdr         *out             = overlay<Hdr>(static_cast<void *>(tx), sizeof(tx));
+    out->type                    = 0xABCD;
+    out->len                     = 7;
+    CHECK(tx[0] == 0xAB && tx[1] == 0xCD && tx[5] == 7);
+
+    // NaN payloads survive the round trip
+    const std::uint32_t snan_bits = 0x7FA00001;
+    float               snan;
+    std::memcpy(&snan, &snan_bits, 4);
+    Packed_BE_Float<float> p(snan);
+    const float            back = p.get();
+    CHECK(std::memcmp(&back, &snan_bits, 4) == 0);
+    CHECK(p.data()[0] == 0x7F && p.data()[3] == 0x01);
+
+    // packed types as record codec fields
+    using Codec = Record_Codec<Field<Packed_BE_Int<std::uint16_t>, 0>, Field<Packed_BE_Int<std::uint32_t>, 2>>;
+    std::uint16_t type[1];
+    std::uint32_t len[1];
+    Codec::decode(rx, 1, type, len);
+    CHECK(type[0] == 0x1234 && len[0] == 0x100);
+
+    return test_result();
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/bulk.hpp"
+#include "cxxendian/packed.hpp"
+#include "cxxendian/reduce.hpp"
+#include "check.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using endian::Order;
+
+static std::mt19937_64 rng(99);
+
+// random values in wire order, stored at an odd offset
+template <Order order, typename T>
+static std::vector<std::uint8_t> make_wire(const std::vector<T> &values) {
+    std::vector<std::uint8_t> wire(values.size() * sizeof(T) + 1);
+    endian::from_host_n<order>(values.data(), wire.data() + 1, values.size());
+    return wire;
+}
+
+template <typename T>
+static std::vector<T> random_values(std::size_t n) {
+    std::vector<T> v(n);
+    for (auto &x : v) {
+        if constexpr (std::is_floating_point<T>::value)
+            x = static_cast<T>(std::uniform_real_distribution<double>(-1000, 1000)(rng));
+        else x = static_cast<T>(rng());
+    }
+    return v;
+}
+
+template <Order order, typename T>
+static void test_int(std::size_t n) {
+    using S          = endian::Sum_Type<T>;
+    const auto v     = random_values<T>(n);
+    const auto wire  = make_wire<order>(v);
+    const auto w     = make_wire<order>(random_values<T>(n));
+    const auto *src  = wire.data() + 1;
+
+    std::uint64_t sum = 0, dot = 0;
+    T             mn = std::numeric_limits<T>::max(), mx = std::numeric_limits<T>::min();
+    std::vector<T> other(n);
+    endian::to_host_n<order>(w.data() + 1, other.data(), n);
+    for (std::size_t i = 0; i < n; ++i) {
+        sum += static_cast<std::uint64_t>(static_cast<S>(v[i]));
+        dot += static_cast<std::uint64_t>(static_cast<S>(v[i])) * static_cast<std::uint64_t>(static_cast<S>(other[i]));
+        mn = std::min(mn, v[i]);
+        mx = std::max(mx, v[i]);
+    }
+
+    CHECK((static_cast<std::uint64_t>(endian::sum_n<order, T>(src, n)) == sum));
+    CHECK((static_cast<std::uint64_t>(endian::dot_n<order, T>(src, w.data() + 1, n)) == dot));
+    CHECK((equal_exact(endian::min_n<order, T>(src, n), mn)));
+    CHECK((equal_exact(endian::max_n<order, T>(src, n), mx)));
+}
+
+// reference for Reduce_Order::Deterministic
+template <typename T>
+static T deterministic_sum(const std::vector<T> &a, const std::vector<T> *b) {
+    T lanes[8] = {};
+    for (std::size_t i = 0; i < a.size(); ++i)
+        lanes[i % 8] += b ? a[i] * (*b)[i] : a[i];
+    return ((lanes[0] + lanes[4]) + (lanes[2] + lanes[6])) + ((lanes[1] + lanes[5]) + (lanes[3] + lanes[7]));
+}
+
+template <Order order, typename T>
+static void test_float(std::size_t n) {
+    const auto  v    = random_values<T>(n);
+    const auto  w    = random_values<T>(n);
+    const auto  wire = make_wire<order>(v);
+    const auto  wb   = make_wire<order>(w);
+    const auto *src  = wire.data() + 1;
+
+    long double sum = 0, dot = 0, abs = 0;
+    T           mn = std::numeric_limits<T>::infinity(), mx = -std::numeric_limits<T>::infinity();
+    for (std::size_t i = 0; i < n; ++i) {
+        sum += v[i];
+        dot += static_cast<long double>(v[i]) * w[i];
+        abs += std::fabs(static_cast<long double>(v[i])) * (1 + std::fabs(static_cast<long double>(w[i])));
+        mn = std::min(mn, v[i]);
+        mx = std::max(mx, v[i]);
+    }
+    const long double tolerance = abs * 4 * std::numeric_limits<T>::epsilon();
+
+    CHECK((std::fabs(endian::sum_n<order, T>(src, n) - sum) <= tolerance));
+    CHECK((std::fabs(endian::dot_n<order, T>(src, wb.data() + 1, n) - dot) <= tolerance));
+    CHECK((equal_exact(endian::min_n<order, T>(src, n), mn)));
+    CHECK((equal_exact(endian::max_n<order, T>(src, n), mx)));
+
+    // bitwise identical to the documented summation order
+    const T ds = endian::sum_n<order, T>(src, n, endian::Reduce_Order::Deterministic);
+    const T rs = deterministic_sum<T>(v, nullptr);
+    CHECK(std::memcmp(&ds, &rs, sizeof(T)) == 0);
+#if !defined(__FP_FAST_FMA) && !defined(__FP_FAST_FMAF)
+    const T dd = endian::dot_n<order, T>(src, wb.data() + 1, n, endian::Reduce_Order::Deterministic);
+    const T rd = deterministic_sum(v, &w);
+    CHECK(std::memcmp(&dd, &rd, sizeof(T)) == 0);
+#endif
+}
+
+template <Order order>
+static void test_all(std::size_t n) {
+    test_int<order, std::int8_t>(n);
+    test_int<order, std::uint8_t>(n);
+    test_int<order, std::int16_t>(n);
+    test_int<order, std::uint16_t>(n);
+    test_int<order, std::int32_t>(n);
+    test_int<order, std::uint32_t>(n);
+    test_int<order, std::int64_t>(n);
+    test_int<order, std::uint64_t>(n);
+    test_float<order, float>(n);
+    test_float<order, double>(n);
+}
+
+int main() {
+    for (std::size_t n : {0, 1, 7, 8, 31, 33, 64, 100, 1000, 4099}) {
+        test_all<Order::Big>(n);
+        test_all<Order::Little>(n);
+    }
+
+    // 16 bit sums that exceed the 32 bit intermediate accumulators
+    {
+        const std::size_t          n = 1 << 21;
+        std::vector<std::uint16_t> u(n, 0xFFFF);
+        std::vector<std::int16_t>  s(n, -32768);
+        const auto                 wu = make_wire<Order::Big>(u);
+        const auto                 ws = make_wire<Order::Big>(s);
+        CHECK((endian::sum_n<Order::Big, std::uint16_t>(wu.data() + 1, n) == std::uint64_t(0xFFFF) * n));
+        CHECK((endian::sum_n<Order::Big, std::int16_t>(ws.data() + 1, n) == -32768 * static_cast<std::int64_t>(n)));
+        CHECK((endian::min_n<Order::Big, std::uint16_t>(wu.data() + 1, n) == 0xFFFF));
+        CHECK((endian::max_n<Order::Big, std::int16_t>(ws.data() + 1, n) == -32768));
+    }
+
+    // empty arrays
+    CHECK((endian::min_n<Order::Big, std::int32_t>(nullptr, 0) == std::numeric_limits<std::int32_t>::max()));
+    CHECK((equal_exact(endian::max_n<Order::Big, float>(nullptr, 0), -std::numeric_limits<float>::infinity())));
+    CHECK((equal_exact(endian::sum_n<Order::Little, double>(nullptr, 0), 0.0)));
+
+    // packed arrays
+    {
+        cxxendian::Packed_BE_Int<std::int32_t> a[5];
+        cxxendian::Packed_BE_Int<std::int32_t> b[5];
+        for (int i = 0; i < 5; ++i) {
+            a[i] = -i;
+            b[i] = i + 1;
+        }
+        CHECK(cxxendian::sum(a, 5) == -10);
+        CHECK(cxxendian::minimum(a, 5) == -4);
+        CHECK(cxxendian::maximum(a, 5) == 0);
+        CHECK(cxxendian::dot(a, b, 5) == -(0 * 1 + 1 * 2 + 2 * 3 + 3 * 4 + 4 * 5));
+
+        cxxendian::Packed_LE_Float<double> f[3];
+        f[0] = 0.5;
+        f[1] = 1.5;
+        f[2] = -4.0;
+        CHECK(equal_exact(cxxendian::sum(f, 3, cxxendian::Reduce_Order::Deterministic), -2.0));
+    }
+
+    return test_result();
+}
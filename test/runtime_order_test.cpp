@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/bulk.hpp"
+#include "cxxendian/columnar.hpp"
+#include "cxxendian/runtime_order.hpp"
+#include "cxxendian/serialize.hpp"
+#include "check.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using endian::Order;
+
+template <typename T>
+static bool same_bits(T a, T b) {
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+template <typename T>
+static std::vector<T> test_values(std::size_t n) {
+    std::vector<T> v(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        if constexpr (std::is_floating_point<T>::value) v[i] = static_cast<T>(i) * T(-1.25);
+        else v[i] = static_cast<T>(i * 0x0123456789ABCDEFull);
+    }
+    return v;
+}
+
+// scalar and bulk access with a run time byte order matches the compile time api
+template <Order order, typename T>
+static void check_order() {
+    const endian::Runtime_Order ro(order);
+    CHECK(ro.order() == order);
+    CHECK(ro.needs_swap() == (order != endian::HostOrder));
+
+    constexpr std::size_t N    = 77;
+    const auto            host = test_values<T>(N);
+    std::vector<T>        expected(N), wire(N), back(N);
+    endian::from_host_n<order>(host.data(), expected.data(), N);
+
+    // scalar
+    bool ok = true;
+    for (std::size_t i = 0; i < N; ++i) {
+        T stored;
+        ro.store(&stored, host[i]);
+        ok = ok && same_bits(stored, expected[i]) && same_bits(ro.load<T>(&expected[i]), host[i]);
+    }
+    CHECK(ok);
+
+    // bulk
+    endian::from_host_n(order, host.data(), wire.data(), N);
+    CHECK(std::memcmp(wire.data(), expected.data(), N * sizeof(T)) == 0);
+    endian::to_host_n(order, wire.data(), back.data(), N);
+    CHECK(back == host);
+
+    std::fill(back.begin(), back.end(), T(0));
+    ro.to_host_n(expected.data(), back.data(), N);
+    CHECK(back == host);
+    ro.from_host_n(host.data(), wire.data(), N);
+    CHECK(std::memcmp(wire.data(), expected.data(), N * sizeof(T)) == 0);
+
+    // kernels selected once
+    const auto                   &kernels   = endian::bulk_kernels<T>(order);
+    decltype(kernels.to_host_n)   to_host   = &endian::to_host_n<order, T>;
+    decltype(kernels.from_host_n) from_host = &endian::from_host_n<order, T>;
+    CHECK(kernels.to_host_n == to_host);
+    CHECK(kernels.from_host_n == from_host);
+}
+
+template <typename T>
+static void check_type() {
+    check_order<Order::Little, T>();
+    check_order<Order::Big, T>();
+}
+
+int main() {
+    check_type<std::uint8_t>();
+    check_type<std::int16_t>();
+    check_type<std::uint32_t>();
+    check_type<std::int64_t>();
+    check_type<float>();
+    check_type<double>();
+
+    // signaling NaN payload survives the scalar access
+    {
+        const std::uint64_t         snan_bits = 0x7FF0000000000123ull;
+        const double                snan      = endian::detail::from_bits<double>(snan_bits);
+        std::uint8_t                buf[8];
+        const endian::Runtime_Order be(Order::Big);
+        be.store(buf, snan);
+        CHECK(buf[0] == 0x7F && buf[1] == 0xF0 && buf[6] == 0x01 && buf[7] == 0x23);
+        CHECK(endian::detail::to_bits(be.load<double>(buf)) == snan_bits);
+    }
+
+    // TIFF like header: byte order mark followed by values in the declared order
+    {
+        const std::uint8_t mm[] = {'M', 'M', 0, 42, 0, 0, 0, 8};
+        const std::uint8_t ii[] = {'I', 'I', 42, 0, 8, 0, 0, 0};
+        for (const std::uint8_t *h : {mm, ii}) {
+            const endian::Runtime_Order ro(h[0] == 'M' ? Order::Big : Order::Little);
+            CHECK(ro.load<std::uint16_t>(h + 2) == 42);
+            CHECK(ro.load<std::uint32_t>(h + 4) == 8);
+
+            // the same generic loop instantiated for the declared order
+            const auto sum = endian::visit_order(ro.order(), [&](auto o) {
+                cxxendian::Reader<decltype(o)::value> r(h + 2, 6);
+                const std::uint32_t                   magic = r.template get<std::uint16_t>();
+                return magic + r.template get<std::uint32_t>();
+            });
+            CHECK(sum == 50);
+        }
+    }
+
+    // records: dynamic codec matches the codec with compile time byte order
+    {
+        using Dynamic = cxxendian::Dynamic_Record_Codec<cxxendian::Dynamic_Field<std::uint16_t, 0>,
+                                                        cxxendian::Dynamic_Field<std::uint32_t, 2>,
+                                                        cxxendian::Dynamic_Field<double, 8>>;
+        using Big     = cxxendian::Record_Codec<cxxendian::Field<cxxendian::BE_Int<std::uint16_t>, 0>,
+                                            cxxendian::Field<cxxendian::BE_Int<std::uint32_t>, 2>,
+                                            cxxendian::Field<cxxendian::BE_Float<double>, 8>>;
+        using Little  = cxxendian::Record_Codec<cxxendian::Field<cxxendian::LE_Int<std::uint16_t>, 0>,
+                                               cxxendian::Field<cxxendian::LE_Int<std::uint32_t>, 2>,
+                                               cxxendian::Field<cxxendian::LE_Float<double>, 8>>;
+        static_assert(Dynamic::size == 16);
+
+        constexpr std::size_t N = 300;
+        const auto            a = test_values<std::uint16_t>(N);
+        const auto            b = test_values<std::uint32_t>(N);
+        const auto            c = test_values<double>(N);
+
+        std::vector<std::uint8_t>  dyn(N * 16), ref(N * 16);
+        std::vector<std::uint16_t> a2(N);
+        std::vector<std::uint32_t> b2(N);
+        std::vector<double>        c2(N);
+
+        Dynamic::encode(Order::Big, dyn.data(), N, a.data(), b.data(), c.data());
+        Big::encode(ref.data(), N, a.data(), b.data(), c.data());
+        CHECK(dyn == ref);
+        Dynamic::decode(Order::Big, dyn.data(), N, a2.data(), b2.data(), c2.data());
+        CHECK(a2 == a && b2 == b && c2 == c);
+
+        // strided, little endian; the gaps between the fields are not modified
+        dyn.assign(N * 20, 0xEE);
+        ref.assign(N * 20, 0xEE);
+        Dynamic::encode_strided(Order::Little, dyn.data(), 20, N, a.data(), b.data(), c.data());
+        Little::encode_strided(ref.data(), 20, N, a.data(), b.data(), c.data());
+        CHECK(dyn == ref);
+        CHECK(dyn[6] == 0xEE && dyn[19] == 0xEE);
+        Dynamic::decode_strided(Order::Little, dyn.data(), 20, N, a2.data(), b2.data(), c2.data());
+        CHECK(a2 == a && b2 == b && c2 == c);
+    }
+
+    return test_result();
+}
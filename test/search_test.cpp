@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/bulk.hpp"
+#include "cxxendian/packed.hpp"
+#include "cxxendian/search.hpp"
+#include "check.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using endian::Order;
+
+static std::mt19937_64 rng(7);
+
+// values from three small ranges (low, around 0, high), so that equal values and range hits are frequent
+template <typename T>
+static std::vector<T> random_values(std::size_t n) {
+    std::vector<T> v(n);
+    for (auto &x : v) {
+        if constexpr (std::is_floating_point<T>::value) x = static_cast<T>(static_cast<int>(rng() % 41) - 20) / 4;
+        else {
+            const T base[] = {std::numeric_limits<T>::min(), T(0), static_cast<T>(std::numeric_limits<T>::max() - 49)};
+            x              = static_cast<T>(base[rng() % 3] + static_cast<T>(rng() % 50));
+        }
+    }
+    return v;
+}
+
+template <Order order, typename T>
+static void test_type(std::size_t n) {
+    auto                      v = random_values<T>(n);
+    std::vector<std::uint8_t> wire(n * sizeof(T) + 3);
+    const std::uint8_t       *src = wire.data() + 3;  // unaligned
+    endian::from_host_n<order>(v.data(), wire.data() + 3, n);
+
+    const auto needles = random_values<T>(8);
+    for (const T needle : needles) {
+        const auto it = std::find(v.begin(), v.end(), needle);
+        CHECK((endian::find_n<order, T>(src, n, needle) == static_cast<std::size_t>(it - v.begin())));
+        CHECK((endian::count_n<order, T>(src, n, needle) ==
+               static_cast<std::size_t>(std::count(v.begin(), v.end(), needle))));
+    }
+
+    // range filter
+    T lo = needles[0], hi = needles[1];
+    if (hi < lo) std::swap(lo, hi);
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < n; ++i)
+        if (lo <= v[i] && v[i] <= hi) expected.push_back(i);
+
+    std::vector<std::uint64_t> mask((n + 63) / 64 + 1, ~std::uint64_t(0));
+    std::vector<std::size_t>   indices(n + 1);
+    CHECK((endian::filter_mask_n<order, T>(src, n, lo, hi, mask.data()) == expected.size()));
+    CHECK((endian::filter_index_n<order, T>(src, n, lo, hi, indices.data()) == expected.size()));
+    indices.resize(expected.size());
+    CHECK(indices == expected);
+
+    bool mask_ok = mask.back() == ~std::uint64_t(0);  // word after the mask untouched
+    for (std::size_t i = 0; i < (n + 63) / 64 * 64; ++i) {
+        const bool bit = (mask[i / 64] >> (i % 64)) & 1;
+        mask_ok        = mask_ok && bit == (i < n && lo <= v[i] && v[i] <= hi);
+    }
+    CHECK(mask_ok);
+
+    // sorted
+    std::sort(v.begin(), v.end());
+    endian::from_host_n<order>(v.data(), wire.data() + 3, n);
+    for (const T needle : needles) {
+        CHECK((endian::lower_bound_n<order, T>(src, n, needle) ==
+               static_cast<std::size_t>(std::lower_bound(v.begin(), v.end(), needle) - v.begin())));
+        CHECK((endian::upper_bound_n<order, T>(src, n, needle) ==
+               static_cast<std::size_t>(std::upper_bound(v.begin(), v.end(), needle) - v.begin())));
+    }
+}
+
+template <Order order>
+static void test_all(std::size_t n) {
+    test_type<order, std::int8_t>(n);
+    test_type<order, std::uint8_t>(n);
+    test_type<order, std::int16_t>(n);
+    test_type<order, std::uint16_t>(n);
+    test_type<order, std::int32_t>(n);
+    test_type<order, std::uint32_t>(n);
+    test_type<order, std::int64_t>(n);
+    test_type<order, std::uint64_t>(n);
+    test_type<order, float>(n);
+    test_type<order, double>(n);
+}
+
+int main() {
+    for (std::size_t n : {0, 1, 5, 16, 31, 32, 33, 63, 64, 65, 100, 1000, 3001}) {
+        test_all<Order::Big>(n);
+        test_all<Order::Little>(n);
+    }
+
+    // signed and unsigned extremes in the range filter
+    {
+        const std::int32_t  s[] = {std::numeric_limits<std::int32_t>::min(), -1, 0, 1, 5, 6, 7, 8,
+                                   std::numeric_limits<std::int32_t>::max()};
+        const std::uint32_t u[] = {0, 1, 0x7FFFFFFF, 0x80000000, 0x80000001, 0xFFFFFFFE, 0xFFFFFFFF, 2, 3};
+        std::uint8_t        ws[sizeof(s)], wu[sizeof(u)];
+        endian::host_to_big_n(s, ws, 9);
+        endian::host_to_big_n(u, wu, 9);
+        std::size_t idx[9];
+        CHECK((endian::filter_index_n<Order::Big, std::int32_t>(ws, 9, -1, 1, idx) == 3 && idx[0] == 1 && idx[2] == 3));
+        CHECK((endian::filter_index_n<Order::Big, std::uint32_t>(wu, 9, 0x7FFFFFFF, 0xFFFFFFFE, idx) == 4));
+        CHECK((endian::find_n<Order::Big, std::uint32_t>(wu, 9, 0xFFFFFFFF) == 6));
+    }
+
+    // floating point: -0.0 == 0.0, NaN never matches
+    {
+        const float  f[] = {1, -0.0f, std::numeric_limits<float>::quiet_NaN(), 3, 0.0f, 2, 2, 2, 9};
+        std::uint8_t wf[sizeof(f)];
+        endian::host_to_little_n(f, wf, 9);
+        std::size_t idx[9];
+        CHECK((endian::find_n<Order::Little, float>(wf, 9, 0.0f) == 1));
+        CHECK((endian::count_n<Order::Little, float>(wf, 9, 0.0f) == 2));
+        CHECK((endian::find_n<Order::Little, float>(wf, 9, std::numeric_limits<float>::quiet_NaN()) == 9));
+        CHECK((endian::filter_index_n<Order::Little, float>(wf, 9, -1.0f, 2.5f, idx) == 6));
+    }
+
+    // packed arrays
+    {
+        cxxendian::Packed_BE_Int<std::uint16_t> a[40];
+        for (std::uint16_t i = 0; i < 40; ++i)
+            a[i] = static_cast<std::uint16_t>(i * 3);
+        std::uint64_t mask[1];
+        CHECK(cxxendian::find(a, 40, std::uint16_t(27)) == 9);
+        CHECK(cxxendian::count(a, 40, std::uint16_t(28)) == 0);
+        CHECK(cxxendian::lower_bound(a, 40, std::uint16_t(28)) == 10);
+        CHECK(cxxendian::upper_bound(a, 40, std::uint16_t(27)) == 10);
+        CHECK(cxxendian::filter_mask(a, 40, std::uint16_t(3), std::uint16_t(9), mask) == 3 && mask[0] == 0xE);
+    }
+
+    return test_result();
+}
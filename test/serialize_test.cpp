@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/serialize.hpp"
+#include "check.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+using namespace cxxendian;
+
+// allocator that counts its allocations
+template <typename T>
+struct Counting_Allocator {
+    using value_type = T;
+
+    std::size_t *allocations;
+
+    explicit Counting_Allocator(std::size_t *counter) noexcept : allocations(counter) {}
+
+    template <typename U>
+    Counting_Allocator(const Counting_Allocator<U> &other) noexcept : allocations(other.allocations) {}
+
+    T *allocate(std::size_t n) {
+        ++*allocations;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *p, std::size_t n) noexcept { std::allocator<T>().deallocate(p, n); }
+
+    template <typename U>
+    bool operator==(const Counting_Allocator<U> &other) const noexcept {
+        return allocations == other.allocations;
+    }
+
+    template <typename U>
+    bool operator!=(const Counting_Allocator<U> &other) const noexcept {
+        return allocations != other.allocations;
+    }
+};
+
+int main() {
+    // big endian message
+    {
+        BE_Writer w;
+        CHECK(w.size() == 0 && w.capacity() == 0);
+        w.put<std::uint16_t>(0x1234);
+        w.put<std::int32_t>(-2);
+        w.put(1.0);
+        w.put<std::uint8_t>(0xAB);
+        const std::uint32_t samples[3] = {1, 0x01020304, 0xFFFFFFFE};
+        w.put_n(samples, 3);
+        w.put_bytes("xy", 2);
+
+        const std::uint8_t expected[] = {0x12, 0x34,                                      // uint16_t
+                                         0xFF, 0xFF, 0xFF, 0xFE,                          // int32_t
+                                         0x3F, 0xF0, 0,    0,    0,    0,    0,    0,     // double
+                                         0xAB,                                            // uint8_t
+                                         0,    0,    0,    1,    1,    2,    3,    4,     // samples
+                                         0xFF, 0xFF, 0xFF, 0xFE, 'x',  'y'};
+        CHECK(w.size() == sizeof(expected));
+        CHECK(std::memcmp(w.data(), expected, sizeof(expected)) == 0);
+
+        BE_Reader r(w.data(), w.size());
+        CHECK(r.get<std::uint16_t>() == 0x1234);
+        CHECK(r.get<std::int32_t>() == -2);
+        CHECK(equal_exact(r.get<double>(), 1.0));
+        CHECK(r.get<std::uint8_t>() == 0xAB);
+        std::uint32_t in[3] = {};
+        CHECK(r.get_n(in, 3));
+        CHECK(std::memcmp(in, samples, sizeof(in)) == 0);
+        char xy[2];
+        CHECK(r.get_bytes(xy, 2) && xy[0] == 'x' && xy[1] == 'y');
+        CHECK(r.remaining() == 0 && r.ok());
+
+        // reading past the end fails all following reads
+        CHECK(r.get<std::uint8_t>() == 0);
+        CHECK(!r.ok());
+    }
+
+    // little endian with patched length field and unchecked access
+    {
+        LE_Writer w(16);
+        CHECK(w.capacity() >= 16);
+        w.put<std::uint32_t>(0);
+        w.reserve(3 * sizeof(std::uint16_t));
+        for (std::uint16_t i = 1; i <= 3; ++i)
+            w.put_unchecked<std::uint16_t>(static_cast<std::uint16_t>(i << 8));
+        w.patch<std::uint32_t>(0, static_cast<std::uint32_t>(w.size() - 4));
+
+        const std::uint8_t expected[] = {6, 0, 0, 0, 0, 1, 0, 2, 0, 3};
+        CHECK(w.size() == sizeof(expected) && std::memcmp(w.data(), expected, sizeof(expected)) == 0);
+
+        LE_Reader r(w.data(), w.size());
+        const auto len = r.get<std::uint32_t>();
+        CHECK(len == 6);
+        CHECK(r.require(len));
+        CHECK(r.get_unchecked<std::uint16_t>() == 0x100);
+        CHECK(r.skip(2));
+        CHECK(r.get_unchecked<std::uint16_t>() == 0x300);
+
+        // truncated messages
+        LE_Reader t(w.data(), 7);
+        std::uint16_t values[3] = {7, 7, 7};
+        CHECK(t.get<std::uint32_t>() == 6);
+        CHECK(!t.get_n(values, 3));
+        CHECK(values[0] == 7 && !t.ok() && t.remaining() == 0);
+        CHECK(t.get<std::uint8_t>() == 0);
+    }
+
+    // growth and allocator
+    {
+        std::size_t allocations = 0;
+        Writer<endian::Order::Big, Counting_Allocator<char>> w {Counting_Allocator<char>(&allocations)};
+        for (std::uint32_t i = 0; i < 10000; ++i)
+            w.put(i);
+        CHECK(w.size() == 40000);
+        CHECK(allocations > 0 && allocations < 20);
+
+        BE_Reader r(w.data(), w.size());
+        bool      ok = true;
+        for (std::uint32_t i = 0; i < 10000; ++i)
+            ok = ok && r.get<std::uint32_t>() == i;
+        CHECK(ok && r.ok() && r.remaining() == 0);
+
+        const std::size_t cap = w.capacity();
+        w.clear();
+        CHECK(w.size() == 0 && w.capacity() == cap);
+
+        auto moved = std::move(w);
+        CHECK(moved.capacity() == cap && w.capacity() == 0);
+    }
+
+    return test_result();
+}
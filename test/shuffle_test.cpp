@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/bulk.hpp"
+#include "cxxendian/shuffle.hpp"
+#include "check.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using endian::Order;
+
+// element bytes in the other byte order
+template <std::size_t W>
+static std::vector<std::uint8_t> reversed(const std::vector<std::uint8_t> &v) {
+    std::vector<std::uint8_t> r(v.size());
+    for (std::size_t i = 0; i < v.size(); ++i)
+        r[i] = v[i / W * W + W - 1 - i % W];
+    return r;
+}
+
+template <Order from, Order planes, std::size_t W>
+static void check_orders(const std::vector<std::uint8_t> &data) {
+    const std::size_t n = data.size() / W;
+
+    // reference: plane k, element i = byte k of element i in byte order planes
+    const auto                ordered = from == planes ? data : reversed<W>(data);
+    std::vector<std::uint8_t> expected(n * W);
+    for (std::size_t k = 0; k < W; ++k)
+        for (std::size_t i = 0; i < n; ++i)
+            expected[k * n + i] = ordered[i * W + k];
+
+    std::vector<std::uint8_t> split(n * W + 1, 0xEE);
+    endian::split_planes_n<from, planes, W>(data.data(), split.data(), n);
+    CHECK(std::equal(expected.begin(), expected.end(), split.begin()));
+    CHECK(split[n * W] == 0xEE);
+
+    // back to the original byte order and to the other byte order
+    constexpr Order           other = from == Order::Big ? Order::Little : Order::Big;
+    std::vector<std::uint8_t> merged(n * W + 1, 0xEE);
+    endian::merge_planes_n<planes, from, W>(split.data(), merged.data(), n);
+    CHECK(std::equal(data.begin(), data.end(), merged.begin()));
+    CHECK(merged[n * W] == 0xEE);
+    endian::merge_planes_n<planes, other, W>(split.data(), merged.data(), n);
+    const auto swapped = reversed<W>(data);
+    CHECK(std::equal(swapped.begin(), swapped.end(), merged.begin()));
+}
+
+template <std::size_t W>
+static void check_width() {
+    std::mt19937 rng(static_cast<unsigned>(W));
+    for (const std::size_t n : {0, 1, 15, 16, 17, 31, 32, 33, 64, 100, 1000}) {
+        std::vector<std::uint8_t> data(n * W);
+        for (auto &b : data)
+            b = static_cast<std::uint8_t>(rng());
+        check_orders<Order::Little, Order::Little, W>(data);
+        check_orders<Order::Little, Order::Big, W>(data);
+        check_orders<Order::Big, Order::Little, W>(data);
+        check_orders<Order::Big, Order::Big, W>(data);
+    }
+}
+
+int main() {
+    check_width<2>();
+    check_width<4>();
+    check_width<8>();
+    check_width<16>();
+
+    // little endian samples, most significant byte first: the sign/upper bytes form runs
+    {
+        const std::vector<std::int32_t> samples = {-2, -1, 0, 1, 2, 300};
+        std::vector<std::uint8_t>       le(samples.size() * 4), planes(samples.size() * 4);
+        endian::host_to_little_n(samples.data(), le.data(), samples.size());
+        endian::split_planes_n<Order::Little, Order::Big, 4>(le.data(), planes.data(), samples.size());
+        const std::vector<std::uint8_t> expected = {0xFF, 0xFF, 0, 0, 0, 0,     // bits 24..31
+                                                    0xFF, 0xFF, 0, 0, 0, 0,     // bits 16..23
+                                                    0xFF, 0xFF, 0, 0, 0, 0x01,  // bits 8..15
+                                                    0xFE, 0xFF, 0, 1, 2, 0x2C};
+        CHECK(planes == expected);
+    }
+
+    return test_result();
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+#include "cxxendian.hpp"
+#include "cxxendian/bulk.hpp"
+#include "cxxendian/packed.hpp"
+#include "cxxendian/sort.hpp"
+#include "check.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using endian::Order;
+
+static std::mt19937_64 rng(11);
+
+// full range values mixed with a few small values (duplicates) and special floating point values
+template <typename T>
+static std::vector<T> random_values(std::size_t n) {
+    std::vector<T> v(n);
+    for (auto &x : v) {
+        if constexpr (std::is_floating_point<T>::value) {
+            const T special[] = {T(0),
+                                 -T(0),
+                                 std::numeric_limits<T>::infinity(),
+                                 -std::numeric_limits<T>::infinity(),
+                                 std::numeric_limits<T>::denorm_min(),
+                                 -std::numeric_limits<T>::max()};
+            switch (rng() % 4) {
+                case 0: x = special[rng() % 6]; break;
+                case 1: x = static_cast<T>(static_cast<int>(rng() % 21) - 10); break;
+                default: {
+                    std::uniform_int_distribution<int> exponent(-30, 29);
+                    x = static_cast<T>(std::ldexp(static_cast<double>(rng() % 2000001) - 1e6, exponent(rng)));
+                }
+            }
+        } else {
+            const auto r = rng();
+            if (rng() % 4 == 0) x = static_cast<T>(r % 16);
+            else std::memcpy(&x, &r, sizeof(T));
+        }
+    }
+    return v;
+}
+
+// reference order: the order of the sort keys (distinguishes -0.0 and 0.0)
+template <typename T>
+static bool key_less(T a, T b) {
+    return endian::detail::encode_key(a) < endian::detail::encode_key(b);
+}
+
+template <typename T>
+static bool same_bits(T a, T b) {
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+template <Order order, typename T>
+static void check_sort(std::size_t n, unsigned threads) {
+    const auto     host = random_values<T>(n);
+    std::vector<T> wire(n);
+    endian::from_host_n<order>(host.data(), wire.data(), n);
+
+    auto expected = host;
+    std::stable_sort(expected.begin(), expected.end(), key_less<T>);
+
+    // sorted data
+    auto sorted = wire;
+    endian::radix_sort_n<order, T>(sorted.data(), n, threads);
+    std::vector<T> result(n);
+    endian::to_host_n<order>(sorted.data(), result.data(), n);
+    CHECK(std::equal(result.begin(), result.end(), expected.begin(), same_bits<T>));
+
+    // permutation (stable: equal values keep their relative order)
+    std::vector<std::size_t> permutation(n);
+    endian::radix_sort_index_n<order, T>(wire.data(), n, permutation.data(), threads);
+    bool ok = true;
+    for (std::size_t i = 0; i < n; ++i) {
+        ok = ok && same_bits(host[permutation[i]], expected[i]);
+        if (i > 0 && same_bits(host[permutation[i]], host[permutation[i - 1]]))
+            ok = ok && permutation[i] > permutation[i - 1];
+    }
+    CHECK(ok);
+}
+
+template <Order order, typename T>
+static void check_sort_all() {
+    for (std::size_t n : {0, 1, 2, 3, 17, 1000})
+        check_sort<order, T>(n, 1);
+    // large enough for multiple threads
+    check_sort<order, T>(300000, 4);
+}
+
+template <typename T>
+static void check_keys() {
+    const auto                v = random_values<T>(2000);
+    std::vector<std::uint8_t> keys(v.size() * sizeof(T));
+    endian::to_sort_keys_n(v.data(), keys.data(), v.size());
+
+    bool ok = true;
+    for (std::size_t i = 0; i + 1 < v.size(); ++i) {
+        const int c = std::memcmp(keys.data() + i * sizeof(T), keys.data() + (i + 1) * sizeof(T), sizeof(T));
+        ok          = ok && (c < 0) == key_less(v[i], v[i + 1]) && (c == 0) == same_bits(v[i], v[i + 1]);
+        if constexpr (std::is_floating_point<T>::value) {
+            if (!equal_exact(v[i], v[i + 1])) ok = ok && (c < 0) == (v[i] < v[i + 1]);
+        } else {
+            ok = ok && (c < 0) == (v[i] < v[i + 1]);
+        }
+    }
+    CHECK(ok);
+
+    std::vector<T> decoded(v.size());
+    endian::from_sort_keys_n(keys.data(), decoded.data(), v.size());
+    CHECK(std::equal(decoded.begin(), decoded.end(), v.begin(), same_bits<T>));
+}
+
+template <typename T>
+static void check_type() {
+    check_sort_all<Order::Big, T>();
+    check_sort_all<Order::Little, T>();
+    check_keys<T>();
+}
+
+int main() {
+    check_type<std::uint8_t>();
+    check_type<std::int8_t>();
+    check_type<std::uint16_t>();
+    check_type<std::int16_t>();
+    check_type<std::uint32_t>();
+    check_type<std::int32_t>();
+    check_type<std::uint64_t>();
+    check_type<std::int64_t>();
+    check_type<float>();
+    check_type<double>();
+
+    // unsigned big endian keys are already memcmp ordered
+    {
+        const std::uint32_t       v[] = {1, 256, 65536, 0xFFFFFFFFu};
+        std::uint8_t              keys[sizeof(v)];
+        std::vector<std::uint8_t> be(sizeof(v));
+        endian::to_sort_keys_n(v, keys, 4);
+        endian::host_to_big_n(v, be.data(), 4);
+        CHECK(std::memcmp(keys, be.data(), sizeof(v)) == 0);
+    }
+
+    // floating point total order
+    {
+        const double v[] = {std::numeric_limits<double>::quiet_NaN(),
+                            1.0,
+                            -0.0,
+                            -std::numeric_limits<double>::infinity(),
+                            0.0,
+                            -std::numeric_limits<double>::quiet_NaN(),
+                            -1.0};
+        std::vector<cxxendian::Packed<double, Order::Big>> packed(std::begin(v), std::end(v));
+        cxxendian::radix_sort(packed.data(), packed.size());
+        CHECK(std::isnan(packed[0].get()) && std::signbit(packed[0].get()));
+        CHECK(equal_exact(packed[1].get(), -std::numeric_limits<double>::infinity()));
+        CHECK(equal_exact(packed[2].get(), -1.0));
+        CHECK(equal_exact(packed[3].get(), 0.0) && std::signbit(packed[3].get()));
+        CHECK(equal_exact(packed[4].get(), 0.0) && !std::signbit(packed[4].get()));
+        CHECK(equal_exact(packed[5].get(), 1.0));
+        CHECK(std::isnan(packed[6].get()) && !std::signbit(packed[6].get()));
+
+        std::size_t permutation[7];
+        cxxendian::radix_sort_index(packed.data(), packed.size(), permutation);
+        CHECK(std::is_sorted(std::begin(permutation), std::end(permutation)));
+    }
+
+    // constant data: all passes are skipped
+    {
+        using P = cxxendian::Packed<std::int64_t, Order::Little>;
+        std::vector<P> packed(100, P(-5));
+        cxxendian::radix_sort(packed.data(), packed.size());
+        CHECK(std::all_of(packed.begin(), packed.end(), [](const auto &p) { return p.get() == -5; }));
+    }
+
+    // exception in the calling thread: the started workers are joined before it propagates (no std::terminate)
+    {
+        std::atomic<unsigned> done {0};
+        bool                  thrown = false;
+        try {
+            endian::detail::parallel_for(4, [&done](unsigned t) {
+                if (t == 0) throw std::runtime_error("worker 0");
+                ++done;
+            });
+        } catch (const std::runtime_error &) {
+            thrown = true;
+        }
+        CHECK(thrown && done == 3);
+    }
+
+    return test_result();
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2022 Nikolas Koesling <nikolas@koesling.info>.
+ * This program is free software. You can redistribute it and/or modify it under the terms of the MIT License.
+ */
+
+/*
+ * Per object endian types (LE_*, BE_*, Host_*): conversions between the byte orders and operators on mixed byte
+ * orders act on the values, never on the stored byte patterns.
+ */
+
+#include "cxxendian.hpp"
+#include "check.hpp"
+
+#include <cstdint>
+#include <limits>
+
+// signaling NaNs with payload, denormals and negative zero survive the conversions between the types bit exactly
+template <typename T>
+static void test_float_bits() {
+    using U                = typename endian::detail::Uint_Of<sizeof(T)>::type;
+    constexpr U QUIET      = sizeof(T) == 4 ? U(0x00400000u) : static_cast<U>(0x0008000000000000ull);
+    constexpr U SIGN       = static_cast<U>(U(1) << (8 * sizeof(T) - 1));
+    const U     patterns[] = {static_cast<U>(endian::detail::to_bits(std::numeric_limits<T>::infinity()) | 1u),
+                              static_cast<U>(endian::detail::to_bits(-std::numeric_limits<T>::infinity()) | 0x35u),
+                              static_cast<U>(endian::detail::to_bits(std::numeric_limits<T>::infinity()) | QUIET | 7u),
+                              endian::detail::to_bits(std::numeric_limits<T>::denorm_min()),
+                              endian::detail::to_bits(-T(0))};
+
+    for (const U p : patterns) {
+        const T                  v = endian::detail::from_bits<T>(p);
+        cxxendian::BE_Float<T>   be(v);
+        cxxendian::LE_Float<T>   le(be);
+        cxxendian::Host_Float<T> h(le);
+        CHECK(h.get_bits() == p);
+        CHECK(be.get_bits() == p);
+        CHECK(le.get_bits() == p);
+        CHECK(be.get_raw() == endian::host_to_big(p));
+        CHECK(le.get_raw() == endian::host_to_little(p));
+
+        cxxendian::BE_Float<T> assigned(T(1));
+        assigned = le;
+        CHECK(assigned.get_bits() == p);
+        cxxendian::Host_Float<T> host_assigned(T(1));
+        host_assigned = be;
+        CHECK(host_assigned.get_bits() == p);
+
+        CHECK((+be).get_bits() == p);
+        CHECK((-le).get_bits() == static_cast<U>(p ^ SIGN));
+    }
+}
+
+template <typename T>
+static void test_float_operators() {
+    // operators act on the values, not on the stored byte order
+    cxxendian::BE_Float<T> a(T(1.5));
+    cxxendian::LE_Float<T> b(T(2));
+    CHECK(equal_exact((a + b).get(), T(3.5)));
+    CHECK(equal_exact((a * b).get(), T(3)));
+    CHECK(a < b && a != b && !(a == b));
+    a += b;
+    CHECK(equal_exact(a.get(), T(3.5)));
+    ++a;
+    CHECK(equal_exact(a.get(), T(4.5)));
+    CHECK(equal_exact((-a).get(), T(-4.5)));
+
+    // postfix increment/decrement: previous value returned, object modified
+    cxxendian::BE_Float<T> c(T(5));
+    const auto             before_inc = c++;
+    CHECK(equal_exact(before_inc.get(), T(5)) && equal_exact(c.get(), T(6)));
+    const auto before_dec = c--;
+    CHECK(equal_exact(before_dec.get(), T(6)) && equal_exact(c.get(), T(5)));
+    --c;
+    CHECK(equal_exact(c.get(), T(4)));
+
+    // remainder on mixed byte orders
+    cxxendian::BE_Float<T> d(T(7.5));
+    cxxendian::LE_Float<T> e(T(2));
+    CHECK(equal_exact((d % e).get(), T(1.5)));
+    d %= e;
+    CHECK(equal_exact(d.get(), T(1.5)));
+}
+
+template <typename T>
+static void test_int_operators() {
+    // operators act on the values, not on the stored byte order
+    cxxendian::BE_Int<T> a(T(1));
+    cxxendian::LE_Int<T> b(T(2));
+    CHECK((a + b).get() == T(3));
+    CHECK((b - a).get() == T(1));
+    CHECK((a * b).get() == T(2));
+    CHECK((b / a).get() == T(2));
+    CHECK((a % b).get() == T(1));
+    CHECK((a | b).get() == T(3) && (a & b).get() == T(0) && (a ^ b).get() == T(3));
+    CHECK((a << b).get() == T(4) && (b >> a).get() == T(1));
+    CHECK((a << 3).get() == T(8) && (b >> 1).get() == T(1));
+    CHECK((~a).get() == static_cast<T>(~T(1)));
+    CHECK((-a).get() == static_cast<T>(-T(1)));
+    a += b;
+    CHECK(a.get() == T(3));
+    a *= b;
+    CHECK(a.get() == T(6));
+    a -= b;
+    CHECK(a.get() == T(4));
+    a /= b;
+    CHECK(a.get() == T(2));
+    a <<= b;
+    CHECK(a.get() == T(8));
+    a >>= 1;
+    CHECK(a.get() == T(4));
+
+    // ordering: 1 < 256 although the big endian byte patterns compare the other way on little endian hosts
+    if (sizeof(T) > 1) {
+        const cxxendian::BE_Int<T> one(T(1));
+        const cxxendian::BE_Int<T> big(T(256));
+        CHECK(one < big && big > one && one <= big && big >= one && one != big && !(one == big));
+        CHECK(cxxendian::LE_Int<T>(T(256)) == big);
+    }
+    CHECK(!cxxendian::BE_Int<T>(T(0)) && (a && b) && (a || cxxendian::LE_Int<T>(T(0))));
+
+    // prefix and postfix increment/decrement: carry into the next byte, previous value returned by postfix
+    cxxendian::BE_Int<T> c(T(0x7F));
+    const auto           before_inc = c++;
+    CHECK(before_inc.get() == T(0x7F) && c.get() == T(0x80));
+    const auto before_dec = c--;
+    CHECK(before_dec.get() == T(0x80) && c.get() == T(0x7F));
+    CHECK((++c).get() == T(0x80));
+    CHECK((--c).get() == T(0x7F));
+    cxxendian::LE_Int<T> d(T(0));
+    d--;
+    CHECK(d.get() == static_cast<T>(T(0) - 1));
+}
+
+int main() {
+    test_int_operators<std::int8_t>();
+    test_int_operators<std::uint16_t>();
+    test_int_operators<std::int32_t>();
+    test_int_operators<std::uint64_t>();
+    test_float_bits<float>();
+    test_float_bits<double>();
+    test_float_operators<float>();
+    test_float_operators<double>();
+
+    return test_result();
+}